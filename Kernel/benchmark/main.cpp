@@ -0,0 +1,772 @@
+//
+
+#include "kernel/utility/utility.hpp"
+#include "kernel/tool/texture/encoding/encode.hpp"
+#include "kernel/tool/texture/encoding/decode.hpp"
+#include "kernel/tool/texture/compression/etc1/compress.hpp"
+#include "kernel/tool/texture/compression/etc1/uncompress.hpp"
+#include "kernel/tool/texture/compression/etc2/compress.hpp"
+#include "kernel/tool/texture/compression/etc2/uncompress.hpp"
+#include "kernel/tool/texture/compression/pvrtc4/compress.hpp"
+#include "kernel/tool/texture/compression/pvrtc4/uncompress.hpp"
+#include "kernel/tool/data/compression/deflate/compress.hpp"
+#include "kernel/tool/data/compression/deflate/uncompress.hpp"
+#include "kernel/tool/data/compression/bzip2/compress.hpp"
+#include "kernel/tool/data/compression/bzip2/uncompress.hpp"
+#include "kernel/tool/data/compression/lzma/compress.hpp"
+#include "kernel/tool/data/compression/lzma/uncompress.hpp"
+#include "kernel/tool/data/differentiation/vcdiff/encode.hpp"
+#include "kernel/tool/data/differentiation/vcdiff/decode.hpp"
+#include "kernel/tool/data/serialization/json/read.hpp"
+#include "kernel/tool/data/serialization/json/write.hpp"
+#include "kernel/tool/data/serialization/xml/read.hpp"
+#include "kernel/tool/data/serialization/xml/write.hpp"
+#include "kernel/tool/popcap/reflection_object_notation/encode.hpp"
+#include "kernel/tool/popcap/reflection_object_notation/decode.hpp"
+#include "kernel/tool/popcap/resource_stream_group/pack.hpp"
+#include "kernel/tool/popcap/resource_stream_group/unpack.hpp"
+#include "kernel/tool/popcap/resource_stream_bundle/pack.hpp"
+#include "kernel/tool/popcap/resource_stream_bundle/unpack.hpp"
+#include "kernel/tool/wwise/sound_bank/decode.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace TwinStar::Kernel::Benchmark {
+
+	#pragma region type
+
+	M_record_of_map(
+		M_wrap(Result),
+		M_wrap(
+			(String) name,
+			(Integer) input_size,
+			(Integer) repetition,
+			(Floater) minimum,
+			(Floater) median,
+			(Floater) mean,
+			(Floater) maximum,
+			(Floater) throughput,
+		),
+	);
+
+	// ----------------
+
+	struct Setting {
+		String         filter;
+		Size           warm_up;
+		Size           repetition;
+		Size           scale;
+		Optional<Path> sample_directory;
+		Path           temporary_directory;
+		Optional<Path> output_file;
+	};
+
+	#pragma endregion
+
+	#pragma region runner
+
+	// NOTE
+	// a benchmark run if its name start with the filter, group guard use the same rule in both direction
+	// time is measured by steady clock in second, throughput is input byte per second of the median time
+	class Runner {
+
+	protected:
+
+		Setting const & m_setting;
+
+		List<Result> m_result;
+
+	public:
+
+		#pragma region structor
+
+		explicit Runner (
+			Setting const & setting
+		) :
+			m_setting{setting},
+			m_result{} {
+		}
+
+		#pragma endregion
+
+		#pragma region query
+
+		auto accept (
+			String const & group
+		) const -> Boolean {
+			auto group_string = mss(group);
+			auto filter_string = mss(thiz.m_setting.filter);
+			return mbw<Boolean>(group_string.starts_with(filter_string) || filter_string.starts_with(group_string));
+		}
+
+		auto result (
+		) const -> List<Result> const & {
+			return thiz.m_result;
+		}
+
+		#pragma endregion
+
+		#pragma region run
+
+		template <typename Action> requires
+			CategoryConstraint<IsPureInstance<Action>>
+			&& (IsGenericCallable<Action>)
+		auto run (
+			String const & name,
+			Size const &   input_size,
+			Action const & action
+		) -> Void {
+			if (!mss(name).starts_with(mss(thiz.m_setting.filter))) {
+				return;
+			}
+			for (auto & index : SizeRange{thiz.m_setting.warm_up}) {
+				action();
+			}
+			auto duration = std::vector<double>{};
+			duration.reserve(thiz.m_setting.repetition.value);
+			for (auto & index : SizeRange{thiz.m_setting.repetition}) {
+				auto begin = std::chrono::steady_clock::now();
+				action();
+				auto end = std::chrono::steady_clock::now();
+				duration.emplace_back(std::chrono::duration<double>{end - begin}.count());
+			}
+			std::sort(duration.begin(), duration.end());
+			auto & result = thiz.m_result.append();
+			result.name = name;
+			result.input_size = cbw<Integer>(input_size);
+			result.repetition = cbw<Integer>(thiz.m_setting.repetition);
+			result.minimum = mbw<Floater>(duration.front());
+			result.median = mbw<Floater>(duration[duration.size() / 2]);
+			result.mean = mbw<Floater>(std::accumulate(duration.begin(), duration.end(), 0.0) / static_cast<double>(duration.size()));
+			result.maximum = mbw<Floater>(duration.back());
+			result.throughput = mbw<Floater>(result.median.value == 0.0 ? (0.0) : (static_cast<double>(input_size.value) / result.median.value));
+			std::fprintf(stderr, "%-56s %12.3f ms %12.3f MiB/s\n", mss(name).c_str(), result.median.value * 1000.0, result.throughput.value / 1048576.0);
+			return;
+		}
+
+		#pragma endregion
+
+	};
+
+	#pragma endregion
+
+	#pragma region input
+
+	inline constexpr auto k_data_unit_size = Size{4_sz * 1024_sz * 1024_sz};
+
+	inline constexpr auto k_image_unit_side = Size{256_sz};
+
+	// ----------------
+
+	// NOTE : xorshift64*, every run generate the same input
+	inline auto make_random_integer (
+		ZIntegerU64 & state
+	) -> ZIntegerU64 {
+		state ^= state >> 12;
+		state ^= state << 25;
+		state ^= state >> 27;
+		return state * 0x2545F4914F6CDD1Dull;
+	}
+
+	inline auto make_random_data (
+		Size const &        size,
+		ZIntegerU64 const & seed
+	) -> ByteArray {
+		auto result = ByteArray{size};
+		auto state = seed;
+		for (auto & element : result) {
+			element = mbw<Byte>(make_random_integer(state) >> 56);
+		}
+		return result;
+	}
+
+	// NOTE : word soup, compress like typical script and manifest text
+	inline auto make_text_data (
+		Size const &        size,
+		ZIntegerU64 const & seed
+	) -> ByteArray {
+		constexpr ZCharacter const * k_word[] = {"resource ", "group ", "subgroup ", "texture ", "image ", "atlas ", "zombie ", "plant ", "level ", "0 ", "1 ", "255 ", "\n"};
+		auto result = ByteArray{size};
+		auto state = seed;
+		auto index = k_begin_index;
+		while (index < size) {
+			auto word = k_word[make_random_integer(state) % std::size(k_word)];
+			for (auto character = word; *character != '\0' && index < size; ++character) {
+				result[index] = mbw<Byte>(*character);
+				++index;
+			}
+		}
+		return result;
+	}
+
+	inline auto make_image (
+		Size const &        side,
+		ZIntegerU64 const & seed
+	) -> Image::Image {
+		auto result = Image::Image{Image::ImageSize{side, side}};
+		auto state = seed;
+		for (auto & y : SizeRange{side}) {
+			for (auto & x : SizeRange{side}) {
+				auto & pixel = result[y][x];
+				auto noise = make_random_integer(state);
+				pixel.red = Image::Color{static_cast<ZIntegerU8>((x.value * 255 / side.value + (noise & 0xF)) & 0xFF)};
+				pixel.green = Image::Color{static_cast<ZIntegerU8>((y.value * 255 / side.value + ((noise >> 8) & 0xF)) & 0xFF)};
+				pixel.blue = Image::Color{static_cast<ZIntegerU8>(((x.value ^ y.value) + ((noise >> 16) & 0xF)) & 0xFF)};
+				pixel.alpha = Image::Color{static_cast<ZIntegerU8>((x.value + y.value) * 255 / (side.value * 2))};
+			}
+		}
+		return result;
+	}
+
+	inline auto make_json_text (
+		Size const & count
+	) -> String {
+		auto result = std::string{};
+		result += "{\n\t\"item\": [\n";
+		for (auto & index : SizeRange{count}) {
+			result += fmt::format(
+				"\t\t{{ \"id\": \"item_{0}\", \"index\": {0}, \"scale\": {1:.4f}, \"enable\": {2}, \"tag\": [\"{3}\", \"{4}\"], \"position\": {{ \"x\": {5}, \"y\": {6} }}, \"empty\": null }}{7}\n",
+				index.value,
+				static_cast<double>(index.value) * 0.125,
+				index.value % 2 == 0 ? "true" : "false",
+				index.value % 3 == 0 ? "plant" : "zombie",
+				index.value % 5 == 0 ? "day" : "night",
+				static_cast<std::int64_t>(index.value % 1024) - 512,
+				static_cast<std::int64_t>(index.value % 768) - 384,
+				index.value + 1 == count.value ? "" : ","
+			);
+		}
+		result += "\t]\n}\n";
+		return make_string(result);
+	}
+
+	inline auto make_xml_text (
+		Size const & count
+	) -> String {
+		auto result = std::string{};
+		result += "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<item>\n";
+		for (auto & index : SizeRange{count}) {
+			result += fmt::format(
+				"\t<entry id=\"item_{0}\" index=\"{0}\" tag=\"{1} &amp; {2}\">\n\t\t<!--entry {0}-->\n\t\t<position x=\"{3}\" y=\"{4}\"/>\n\t\t<name>{1}&lt;{0}&gt;</name>\n\t</entry>\n",
+				index.value,
+				index.value % 3 == 0 ? "plant" : "zombie",
+				index.value % 5 == 0 ? "day" : "night",
+				static_cast<std::int64_t>(index.value % 1024) - 512,
+				static_cast<std::int64_t>(index.value % 768) - 384
+			);
+		}
+		result += "</item>\n";
+		return make_string(result);
+	}
+
+	inline auto read_sample_file (
+		Setting const & setting,
+		String const &  name
+	) -> Optional<ByteArray> {
+		auto result = Optional<ByteArray>{};
+		if (setting.sample_directory.has() && FileSystem::exist_file(setting.sample_directory.get() / name)) {
+			result.set(FileSystem::read_file(setting.sample_directory.get() / name));
+		}
+		return result;
+	}
+
+	#pragma endregion
+
+	#pragma region suite
+
+	inline auto run_texture (
+		Runner &        runner,
+		Setting const & setting
+	) -> Void {
+		if (!runner.accept("texture."_s)) {
+			return;
+		}
+		auto side = k_image_unit_side * setting.scale;
+		auto image = make_image(side, 0x7E57ull);
+		auto image_size = side * side * 4_sz;
+		auto data = ByteArray{image_size};
+		auto data_size = Size{};
+		auto restored_image = Image::Image{Image::ImageSize{side, side}};
+		auto run_pair = [&] (
+			String const & name,
+			auto const &   encode,
+			auto const &   decode
+		) {
+			runner.run(name + ".encode"_s, image_size, [&] {
+				auto data_stream = OByteStreamView{data.view()};
+				encode(data_stream);
+				data_size = data_stream.position();
+			});
+			if (runner.accept(name + ".decode"_s)) {
+				auto data_stream = OByteStreamView{data.view()};
+				encode(data_stream);
+				data_size = data_stream.position();
+			}
+			runner.run(name + ".decode"_s, image_size, [&] {
+				auto data_stream = IByteStreamView{data.view().head(data_size)};
+				decode(data_stream);
+			});
+		};
+		using Tool::Texture::Encoding::Format;
+		for (auto & [format_name, format] : std::initializer_list<std::pair<ZCharacter const *, Format>>{
+			{"rgba_8888", Format::Constant::rgba_8888()},
+			{"argb_8888", Format::Constant::argb_8888()},
+			{"rgb_565", Format::Constant::rgb_565()},
+			{"rgba_4444", Format::Constant::rgba_4444()},
+			{"la_88", Format::Constant::la_88()},
+		}) {
+			run_pair(
+				format_string("texture.encoding.{}"_sv, format_name),
+				[&] (OByteStreamView & data_stream) {
+					Tool::Texture::Encoding::Encode::process(data_stream, image.view(), format);
+				},
+				[&] (IByteStreamView & data_stream) {
+					Tool::Texture::Encoding::Decode::process(data_stream, restored_image.view(), format);
+				}
+			);
+		}
+		run_pair(
+			"texture.compression.etc1"_s,
+			[&] (OByteStreamView & data_stream) {
+				Tool::Texture::Compression::ETC1::Compress::process(data_stream, image.view());
+			},
+			[&] (IByteStreamView & data_stream) {
+				Tool::Texture::Compression::ETC1::Uncompress::process(data_stream, restored_image.view());
+			}
+		);
+		run_pair(
+			"texture.compression.etc2"_s,
+			[&] (OByteStreamView & data_stream) {
+				Tool::Texture::Compression::ETC2::Compress::process(data_stream, image.view(), k_true);
+			},
+			[&] (IByteStreamView & data_stream) {
+				Tool::Texture::Compression::ETC2::Uncompress::process(data_stream, restored_image.view(), k_true);
+			}
+		);
+		run_pair(
+			"texture.compression.pvrtc4"_s,
+			[&] (OByteStreamView & data_stream) {
+				Tool::Texture::Compression::PVRTC4::Compress::process(data_stream, image.view(), k_true);
+			},
+			[&] (IByteStreamView & data_stream) {
+				Tool::Texture::Compression::PVRTC4::Uncompress::process(data_stream, restored_image.view(), k_true);
+			}
+		);
+		return;
+	}
+
+	inline auto run_compression (
+		Runner &        runner,
+		Setting const & setting
+	) -> Void {
+		if (!runner.accept("data.compression."_s)) {
+			return;
+		}
+		auto raw = make_text_data(k_data_unit_size * setting.scale, 0xC0DEull);
+		auto ripe = ByteArray{raw.size() + raw.size() / 2_sz + 4096_sz};
+		auto ripe_size = Size{};
+		auto restored_raw = ByteArray{raw.size()};
+		auto run_pair = [&] (
+			String const & name,
+			auto const &   compress,
+			auto const &   uncompress
+		) {
+			auto do_compress = [&] {
+				auto raw_stream = IByteStreamView{raw.view()};
+				auto ripe_stream = OByteStreamView{ripe.view()};
+				compress(raw_stream, ripe_stream);
+				ripe_size = ripe_stream.position();
+			};
+			runner.run(name + ".compress"_s, raw.size(), do_compress);
+			if (runner.accept(name + ".uncompress"_s)) {
+				do_compress();
+			}
+			runner.run(name + ".uncompress"_s, raw.size(), [&] {
+				auto ripe_stream = IByteStreamView{ripe.view().head(ripe_size)};
+				auto raw_stream = OByteStreamView{restored_raw.view()};
+				uncompress(ripe_stream, raw_stream);
+			});
+		};
+		run_pair(
+			"data.compression.deflate"_s,
+			[&] (IByteStreamView & raw_stream, OByteStreamView & ripe_stream) {
+				Tool::Data::Compression::Deflate::Compress::process(raw_stream, ripe_stream, 6_sz, 15_sz, 8_sz, Tool::Data::Compression::Deflate::Strategy::Constant::default_mode(), Tool::Data::Compression::Deflate::Wrapper::Constant::zlib());
+			},
+			[&] (IByteStreamView & ripe_stream, OByteStreamView & raw_stream) {
+				Tool::Data::Compression::Deflate::Uncompress::process(ripe_stream, raw_stream, 15_sz, Tool::Data::Compression::Deflate::Wrapper::Constant::zlib());
+			}
+		);
+		run_pair(
+			"data.compression.bzip2"_s,
+			[&] (IByteStreamView & raw_stream, OByteStreamView & ripe_stream) {
+				Tool::Data::Compression::BZip2::Compress::process(raw_stream, ripe_stream, 9_sz, 0_sz);
+			},
+			[&] (IByteStreamView & ripe_stream, OByteStreamView & raw_stream) {
+				Tool::Data::Compression::BZip2::Uncompress::process(ripe_stream, raw_stream, k_false);
+			}
+		);
+		run_pair(
+			"data.compression.lzma"_s,
+			[&] (IByteStreamView & raw_stream, OByteStreamView & ripe_stream) {
+				Tool::Data::Compression::Lzma::Compress::process(raw_stream, ripe_stream, 5_sz);
+			},
+			[&] (IByteStreamView & ripe_stream, OByteStreamView & raw_stream) {
+				Tool::Data::Compression::Lzma::Uncompress::process(ripe_stream, raw_stream);
+			}
+		);
+		return;
+	}
+
+	inline auto run_differentiation (
+		Runner &        runner,
+		Setting const & setting
+	) -> Void {
+		if (!runner.accept("data.differentiation."_s)) {
+			return;
+		}
+		auto before = make_text_data(k_data_unit_size * setting.scale, 0xBEF0ull);
+		auto after = ByteArray{before.view()};
+		auto state = ZIntegerU64{0xAF7Eull};
+		for (auto index = k_begin_index; index < after.size(); index += 4096_sz) {
+			after[index] = mbw<Byte>(make_random_integer(state) >> 56);
+		}
+		auto patch = ByteArray{after.size() * 2_sz + 4096_sz};
+		auto patch_size = Size{};
+		auto restored_after = ByteArray{after.size()};
+		auto do_encode = [&] {
+			auto before_stream = IByteStreamView{before.view()};
+			auto after_stream = IByteStreamView{after.view()};
+			auto patch_stream = OByteStreamView{patch.view()};
+			Tool::Data::Differentiation::VCDiff::Encode::process(before_stream, after_stream, patch_stream, k_false);
+			patch_size = patch_stream.position();
+		};
+		runner.run("data.differentiation.vcdiff.encode"_s, after.size(), do_encode);
+		if (runner.accept("data.differentiation.vcdiff.decode"_s)) {
+			do_encode();
+		}
+		runner.run("data.differentiation.vcdiff.decode"_s, after.size(), [&] {
+			auto before_stream = IByteStreamView{before.view()};
+			auto after_stream = OByteStreamView{restored_after.view()};
+			auto patch_stream = IByteStreamView{patch.view().head(patch_size)};
+			Tool::Data::Differentiation::VCDiff::Decode::process(before_stream, after_stream, patch_stream, after.size());
+		});
+		return;
+	}
+
+	inline auto run_serialization (
+		Runner &        runner,
+		Setting const & setting
+	) -> Void {
+		if (!runner.accept("data.serialization."_s) && !runner.accept("popcap.reflection_object_notation."_s)) {
+			return;
+		}
+		constexpr auto rton_version = Tool::PopCap::ReflectionObjectNotation::Version{.number = 1_i, .native_string_encoding_use_utf8 = k_true};
+		auto text = String{};
+		if (auto sample = read_sample_file(setting, "json.json"_s); sample.has()) {
+			text = String{from_byte_view<Character, BasicCharacterListView>(sample.get().view())};
+		}
+		else {
+			text = make_json_text(20000_sz * setting.scale);
+		}
+		auto value = JSON::Value{};
+		Tool::Data::Serialization::JSON::Read::process(as_lvalue(ICharacterStreamView{text.view()}), value);
+		runner.run("data.serialization.json.read"_s, text.size(), [&] {
+			auto text_stream = ICharacterStreamView{text.view()};
+			Tool::Data::Serialization::JSON::Read::process(text_stream, value);
+		});
+		auto text_buffer = ByteArray{text.size() * 4_sz + 4096_sz};
+		runner.run("data.serialization.json.write"_s, text.size(), [&] {
+			auto text_stream = OCharacterStreamView{from_byte_view<Character, BasicCharacterListView>(text_buffer.view())};
+			Tool::Data::Serialization::JSON::Write::process(text_stream, value, k_false, k_false, k_false, k_false);
+		});
+		if (runner.accept("data.serialization.xml."_s)) {
+			auto xml_text = make_xml_text(20000_sz * setting.scale);
+			auto xml_value = XML::Node{};
+			Tool::Data::Serialization::XML::Read::process(xml_text, xml_value);
+			auto xml_rewritten_text = String{};
+			Tool::Data::Serialization::XML::Write::process(xml_rewritten_text, xml_value);
+			runner.run("data.serialization.xml.read"_s, xml_text.size(), [&] {
+				Tool::Data::Serialization::XML::Read::process(xml_text, xml_value);
+			});
+			runner.run("data.serialization.xml.write"_s, xml_text.size(), [&] {
+				Tool::Data::Serialization::XML::Write::process(xml_rewritten_text, xml_value);
+			});
+		}
+		auto data = ByteArray{text.size() * 2_sz + 4096_sz};
+		auto data_size = Size{};
+		auto do_encode = [&] {
+			auto data_stream = OByteStreamView{data.view()};
+			Tool::PopCap::ReflectionObjectNotation::Encode<rton_version>::process(data_stream, value, k_true, k_true);
+			data_size = data_stream.position();
+		};
+		runner.run("popcap.reflection_object_notation.encode"_s, text.size(), do_encode);
+		if (runner.accept("popcap.reflection_object_notation.decode"_s)) {
+			do_encode();
+		}
+		runner.run("popcap.reflection_object_notation.decode"_s, text.size(), [&] {
+			auto data_stream = IByteStreamView{data.view().head(data_size)};
+			Tool::PopCap::ReflectionObjectNotation::Decode<rton_version>::process(data_stream, value);
+		});
+		auto arena = Arena{};
+		runner.run("popcap.reflection_object_notation.decode.arena"_s, text.size(), [&] {
+			{
+				auto arena_scope = ArenaScope{arena};
+				auto data_stream = IByteStreamView{data.view().head(data_size)};
+				auto arena_value = JSON::Value{};
+				Tool::PopCap::ReflectionObjectNotation::Decode<rton_version>::process(data_stream, arena_value);
+			}
+			arena.reset();
+		});
+		return;
+	}
+
+	inline auto run_package (
+		Runner &        runner,
+		Setting const & setting
+	) -> Void {
+		if (!runner.accept("popcap.resource_stream_"_s)) {
+			return;
+		}
+		constexpr auto group_version = Tool::PopCap::ResourceStreamGroup::Version{.number = 4_i};
+		constexpr auto bundle_version = Tool::PopCap::ResourceStreamBundle::Version{.number = 4_i, .extended_texture_information_for_pvz2_cn = 0_i};
+		using GroupDefinition = Tool::PopCap::ResourceStreamGroup::Definition<group_version>;
+		using BundleDefinition = Tool::PopCap::ResourceStreamBundle::Definition<bundle_version>;
+		using Tool::PopCap::ResourceStreamBundle::ResourceType;
+		auto general_count = 64_sz * setting.scale;
+		auto general_size = 64_sz * 1024_sz;
+		auto texture_count = 4_sz * setting.scale;
+		auto texture_side = 256_sz;
+		auto subgroup_count = 4_sz;
+		auto resource_directory = setting.temporary_directory / "resource"_s;
+		auto input_size = k_none_size;
+		auto make_general_path = [&] (Size const & index) { return Path{format_string("general/{}.bin"_sv, index.value)}; };
+		auto make_texture_path = [&] (Size const & index) { return Path{format_string("texture/{}.ptx"_sv, index.value)}; };
+		for (auto & index : SizeRange{general_count}) {
+			FileSystem::write_file(resource_directory / make_general_path(index), make_text_data(general_size, 0x6E00ull + index.value).view());
+			input_size += general_size;
+		}
+		for (auto & index : SizeRange{texture_count}) {
+			FileSystem::write_file(resource_directory / make_texture_path(index), make_random_data(texture_side * texture_side * 4_sz, 0x7E00ull + index.value).view());
+			input_size += texture_side * texture_side * 4_sz;
+		}
+		if (runner.accept("popcap.resource_stream_group."_s)) {
+			auto definition = typename GroupDefinition::Package{};
+			definition.compression.general = k_true;
+			definition.compression.texture = k_false;
+			definition.resource.allocate_full(general_count + texture_count);
+			for (auto & index : SizeRange{general_count}) {
+				auto & resource = definition.resource[index];
+				resource.path = make_general_path(index);
+				resource.additional.template set_of_type<ResourceType::Constant::general()>();
+			}
+			for (auto & index : SizeRange{texture_count}) {
+				auto & resource = definition.resource[general_count + index];
+				resource.path = make_texture_path(index);
+				auto & additional = resource.additional.template set_of_type<ResourceType::Constant::texture()>();
+				additional.index = cbw<Integer>(index);
+				additional.size.width = cbw<Integer>(texture_side);
+				additional.size.height = cbw<Integer>(texture_side);
+			}
+			auto data_size_bound = Size{};
+			Tool::PopCap::ResourceStreamGroup::Pack<group_version>::estimate(definition, resource_directory, data_size_bound);
+			auto data = ByteArray{data_size_bound};
+			auto data_size = Size{};
+			auto do_pack = [&] {
+				auto data_stream = OByteStreamView{data.view()};
+				Tool::PopCap::ResourceStreamGroup::Pack<group_version>::process(data_stream, definition, resource_directory);
+				data_size = data_stream.position();
+			};
+			runner.run("popcap.resource_stream_group.pack"_s, input_size, do_pack);
+			if (runner.accept("popcap.resource_stream_group.unpack"_s)) {
+				do_pack();
+			}
+			runner.run("popcap.resource_stream_group.unpack"_s, input_size, [&] {
+				auto data_stream = IByteStreamView{data.view().head(data_size)};
+				auto restored_definition = typename GroupDefinition::Package{};
+				Tool::PopCap::ResourceStreamGroup::Unpack<group_version>::process(data_stream, restored_definition, k_null_optional);
+			});
+		}
+		if (runner.accept("popcap.resource_stream_bundle."_s)) {
+			auto definition = typename BundleDefinition::Package{};
+			auto & group = definition.group.append();
+			group.id = "BenchmarkGroup"_s;
+			group.composite = k_false;
+			group.subgroup.allocate_full(subgroup_count);
+			for (auto & subgroup_index : SizeRange{subgroup_count}) {
+				auto & subgroup = group.subgroup[subgroup_index];
+				subgroup.id = format_string("BenchmarkSubgroup{}"_sv, subgroup_index.value);
+				subgroup.compression.general = k_true;
+				subgroup.compression.texture = k_false;
+				for (auto index = subgroup_index; index < general_count; index += subgroup_count) {
+					auto & resource = subgroup.resource.append();
+					resource.path = make_general_path(index);
+					resource.additional.template set_of_type<ResourceType::Constant::general()>();
+				}
+				for (auto index = subgroup_index; index < texture_count; index += subgroup_count) {
+					auto & resource = subgroup.resource.append();
+					resource.path = make_texture_path(index);
+					auto & additional = resource.additional.template set_of_type<ResourceType::Constant::texture()>();
+					additional.size.width = cbw<Integer>(texture_side);
+					additional.size.height = cbw<Integer>(texture_side);
+					additional.format = 0_i;
+					additional.pitch = cbw<Integer>(texture_side * 4_sz);
+				}
+			}
+			auto manifest = Optional<typename Tool::PopCap::ResourceStreamBundle::Manifest<bundle_version>::Package>{};
+			auto data = ByteArray{input_size * 2_sz + 1024_sz * 1024_sz};
+			auto data_size = Size{};
+			auto do_pack = [&] {
+				auto data_stream = OByteStreamView{data.view()};
+				Tool::PopCap::ResourceStreamBundle::Pack<bundle_version>::process(data_stream, definition, manifest, resource_directory, k_null_optional, k_null_optional);
+				data_size = data_stream.position();
+			};
+			runner.run("popcap.resource_stream_bundle.pack"_s, input_size, do_pack);
+			if (runner.accept("popcap.resource_stream_bundle.unpack"_s)) {
+				do_pack();
+			}
+			runner.run("popcap.resource_stream_bundle.unpack"_s, input_size, [&] {
+				auto data_stream = IByteStreamView{data.view().head(data_size)};
+				auto restored_definition = typename BundleDefinition::Package{};
+				auto restored_manifest = Optional<typename Tool::PopCap::ResourceStreamBundle::Manifest<bundle_version>::Package>{};
+				Tool::PopCap::ResourceStreamBundle::Unpack<bundle_version>::process(data_stream, restored_definition, restored_manifest, k_null_optional, k_null_optional);
+			});
+		}
+		FileSystem::remove(resource_directory);
+		return;
+	}
+
+	// NOTE : sound bank can not be synthesized, only recorded sample named sound_bank.<version>.bnk is measured
+	inline auto run_wwise (
+		Runner &        runner,
+		Setting const & setting
+	) -> Void {
+		if (!runner.accept("wwise.sound_bank."_s)) {
+			return;
+		}
+		Generalization::each<Tool::Wwise::SoundBank::VersionPackage>(
+			[&] <auto index, auto version> (ValuePackage<index>, ValuePackage<version>) {
+				auto data = read_sample_file(setting, format_string("sound_bank.{}.bnk"_sv, version.number.value));
+				if (!data.has()) {
+					return;
+				}
+				runner.run(format_string("wwise.sound_bank.{}.decode"_sv, version.number.value), data.get().size(), [&] {
+					auto data_stream = IByteStreamView{data.get().view()};
+					auto definition = typename Tool::Wwise::SoundBank::Definition<version>::SoundBank{};
+					Tool::Wwise::SoundBank::Decode<version>::process(data_stream, definition, k_null_optional);
+				});
+				auto arena = Arena{};
+				runner.run(format_string("wwise.sound_bank.{}.decode.arena"_sv, version.number.value), data.get().size(), [&] {
+					{
+						auto arena_scope = ArenaScope{arena};
+						auto data_stream = IByteStreamView{data.get().view()};
+						auto definition = typename Tool::Wwise::SoundBank::Definition<version>::SoundBank{};
+						Tool::Wwise::SoundBank::Decode<version>::process(data_stream, definition, k_null_optional);
+					}
+					arena.reset();
+				});
+			}
+		);
+		return;
+	}
+
+	#pragma endregion
+
+	#pragma region entry
+
+	inline auto parse_setting (
+		std::vector<std::string> const & argument
+	) -> Setting {
+		auto setting = Setting{
+			.filter = ""_s,
+			.warm_up = 1_sz,
+			.repetition = 5_sz,
+			.scale = 1_sz,
+			.sample_directory = k_null_optional,
+			.temporary_directory = Path{"./benchmark.temporary"_s},
+			.output_file = k_null_optional,
+		};
+		for (auto index = std::size_t{0}; index < argument.size(); index += 2) {
+			assert_test(index + 1 < argument.size());
+			auto & key = argument[index];
+			auto & value = argument[index + 1];
+			if (key == "--filter") {
+				setting.filter = make_string(value);
+			}
+			else if (key == "--warm-up") {
+				setting.warm_up = mbw<Size>(std::stoull(value));
+			}
+			else if (key == "--repetition") {
+				setting.repetition = mbw<Size>(std::stoull(value));
+			}
+			else if (key == "--scale") {
+				setting.scale = mbw<Size>(std::stoull(value));
+			}
+			else if (key == "--sample") {
+				setting.sample_directory.set(Path{make_string(value)});
+			}
+			else if (key == "--temporary") {
+				setting.temporary_directory = Path{make_string(value)};
+			}
+			else if (key == "--output") {
+				setting.output_file.set(Path{make_string(value)});
+			}
+			else {
+				throw IncompleteException{};
+			}
+		}
+		assert_test(setting.repetition > 0_sz);
+		assert_test(setting.scale > 0_sz && std::has_single_bit(setting.scale.value));
+		return setting;
+	}
+
+	inline auto execute (
+		std::vector<std::string> const & argument
+	) -> Void {
+		auto setting = parse_setting(argument);
+		auto runner = Runner{setting};
+		run_texture(runner, setting);
+		run_compression(runner, setting);
+		run_differentiation(runner, setting);
+		run_serialization(runner, setting);
+		run_package(runner, setting);
+		run_wwise(runner, setting);
+		auto result = JSON::Value{};
+		result.from(runner.result());
+		auto result_buffer = ByteArray{runner.result().size() * 512_sz + 4096_sz};
+		auto result_stream = OCharacterStreamView{from_byte_view<Character, BasicCharacterListView>(result_buffer.view())};
+		Tool::Data::Serialization::JSON::Write::process(result_stream, result, k_true, k_false, k_true, k_false);
+		if (setting.output_file.has()) {
+			FileSystem::write_file(setting.output_file.get(), to_byte_view(result_stream.stream_view()));
+		}
+		else {
+			std::fwrite(result_stream.stream_view().begin().value, 1, result_stream.position().value, stdout);
+		}
+		return;
+	}
+
+	#pragma endregion
+
+}
+
+#pragma region main
+
+auto main (
+	int    argc,
+	char * argv[]
+) -> int {
+	try {
+		TwinStar::Kernel::Benchmark::execute(std::vector<std::string>{argv + 1, argv + argc});
+		return 0;
+	}
+	catch (...) {
+		auto exception = TwinStar::Kernel::parse_current_exception();
+		std::fprintf(stderr, "%s\n", exception.what().c_str());
+		return 1;
+	}
+}
+
+#pragma endregion
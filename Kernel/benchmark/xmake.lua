@@ -0,0 +1,47 @@
+-- benchmark
+
+target('benchmark', function()
+	set_group('source')
+	set_kind('binary')
+	add_headerfiles(
+		{ install = false }
+	)
+	add_files(
+		'./main.cpp',
+		{}
+	)
+	add_includedirs(
+		m.root .. '',
+		{ private = true }
+	)
+	add_deps(
+		'third.mscharconv',
+		'third.fmt',
+		'third.tinyxml2',
+		'third.md5',
+		'third.Rijndael',
+		'third.zlib',
+		'third.bzip2',
+		'third.lzma',
+		'third.open_vcdiff',
+		'third.libpng',
+		'third.ETCPACK',
+		'third.etcpak',
+		'third.PVRTCCompressor',
+		{}
+	)
+	on_load(function(target)
+		import('custom')
+		custom.apply_condition_definition_basic(target)
+		custom.apply_compiler_option_basic(target)
+		custom.apply_compiler_option_warning_regular(target)
+	end)
+	set_runargs(
+		'--warm-up', '1',
+		'--repetition', '5',
+		'--scale', '1',
+		'--temporary', './benchmark.temporary',
+		'--output', './benchmark.json',
+		{ private = true }
+	)
+end)
@@ -33,6 +33,9 @@
 #include "kernel/tool/texture/compression/pvrtc4/uncompress.hpp"
 #include "kernel/tool/texture/file/png/write.hpp"
 #include "kernel/tool/texture/file/png/read.hpp"
+#include "kernel/tool/texture/atlas/pack.hpp"
+#include "kernel/tool/texture/atlas/compose.hpp"
+#include "kernel/tool/texture/atlas/split.hpp"
 #include "kernel/tool/wwise/sound_bank/encode.hpp"
 #include "kernel/tool/wwise/sound_bank/decode.hpp"
 #include "kernel/tool/marmalade/dzip/pack.hpp"
@@ -49,6 +52,8 @@
 #include "kernel/tool/popcap/sexy_texture/decode.hpp"
 #include "kernel/tool/popcap/animation/encode.hpp"
 #include "kernel/tool/popcap/animation/decode.hpp"
+#include "kernel/tool/popcap/animation/convert/flash/from.hpp"
+#include "kernel/tool/popcap/animation/convert/flash/to.hpp"
 #include "kernel/tool/popcap/re_animation/encode.hpp"
 #include "kernel/tool/popcap/re_animation/decode.hpp"
 #include "kernel/tool/popcap/particle/encode.hpp"
@@ -75,6 +80,8 @@
 #include "kernel/tool/miscellaneous/pvz2_cn_alpha_palette_texture/decode.hpp"
 #include "kernel/tool/miscellaneous/pvz2_cn_crypt_data/encrypt.hpp"
 #include "kernel/tool/miscellaneous/pvz2_cn_crypt_data/decrypt.hpp"
+#include "kernel/tool/miscellaneous/pvz2_resource_manifest/encode.hpp"
+#include "kernel/tool/miscellaneous/pvz2_resource_manifest/decode.hpp"
 
 namespace TwinStar::Kernel::Executor::Interface {
 
@@ -434,6 +441,8 @@ namespace TwinStar::Kernel::Executor::Interface {
 			auto s_Image = s_Kernel.add_space("Image"_s);
 			define_generic_class<Image::ImageSize>(s_Image, "ImageSize"_s);
 			define_generic_class<Image::ImagePosition>(s_Image, "ImagePosition"_s);
+			define_generic_class<List<Image::ImageSize>>(s_Image, "ImageSizeList"_s);
+			define_generic_class<List<Image::ImagePosition>>(s_Image, "ImagePositionList"_s);
 			define_generic_class<Image::Color>(s_Image, "Color"_s);
 			define_generic_class<List<Image::Color>>(s_Image, "ColorList"_s);
 			define_generic_class<Image::Pixel>(s_Image, "Pixel"_s);
@@ -471,6 +480,7 @@ namespace TwinStar::Kernel::Executor::Interface {
 				.add_function_proxy<&stpg<&FileSystem::size_file>>("size_file"_s)
 				.add_function_proxy<&stpg<&FileSystem::resize_file>>("resize_file"_s)
 				.add_function_proxy<&stpg<&FileSystem::read_file>>("read_file"_s)
+				.add_function_proxy<&stpg<&FileSystem::read_file_part>>("read_file_part"_s)
 				.add_function_proxy<&stpg<&FileSystem::write_file>>("write_file"_s)
 				.add_function_proxy<&stpg<&FileSystem::read_stream_file>>("read_stream_file"_s)
 				.add_function_proxy<&stpg<&FileSystem::write_stream_file>>("write_stream_file"_s)
@@ -513,12 +523,14 @@ namespace TwinStar::Kernel::Executor::Interface {
 						define_generic_class<Tool::Data::Hash::FNV::Mode>(s_FNV, "Mode"_s);
 						define_generic_class<Tool::Data::Hash::FNV::BitCount>(s_FNV, "BitCount"_s);
 						s_FNV.add_space("Hash"_s)
-							.add_function_proxy<&stpg<Tool::Data::Hash::FNV::Hash::process>>("process"_s);
+							.add_function_proxy<&stpg<Tool::Data::Hash::FNV::Hash::process>>("process"_s)
+							.add_function_proxy<&stpg<Tool::Data::Hash::FNV::Hash::process_file>>("process_file"_s);
 					}
 					{
 						auto s_MD5 = s_Hash.add_space("MD5"_s);
 						s_MD5.add_space("Hash"_s)
-							.add_function_proxy<&stpg<&Tool::Data::Hash::MD5::Hash::process>>("process"_s);
+							.add_function_proxy<&stpg<&Tool::Data::Hash::MD5::Hash::process>>("process"_s)
+							.add_function_proxy<&stpg<&Tool::Data::Hash::MD5::Hash::process_file>>("process_file"_s);
 					}
 				}
 				{
@@ -609,6 +621,7 @@ namespace TwinStar::Kernel::Executor::Interface {
 				auto s_Texture = s_Tool.add_space("Texture"_s);
 				{
 					auto s_Transformation = s_Texture.add_space("Transformation"_s);
+					define_generic_class<Tool::Texture::Transformation::ScaleMethod>(s_Transformation, "ScaleMethod"_s);
 					s_Transformation.add_space("Flip"_s)
 						.add_function_proxy<&stpg<&Tool::Texture::Transformation::Flip::process>>("process"_s);
 					s_Transformation.add_space("Scale"_s)
@@ -650,13 +663,30 @@ namespace TwinStar::Kernel::Executor::Interface {
 					auto s_File = s_Texture.add_space("File"_s);
 					{
 						auto s_PNG = s_File.add_space("PNG"_s);
+						define_generic_class<Tool::Texture::File::PNG::Effort>(s_PNG, "Effort"_s);
 						s_PNG.add_space("Write"_s)
-							.add_function_proxy<&stpg<&Tool::Texture::File::PNG::Write::process>>("process"_s);
+							.add_function_proxy<&stpg<&Tool::Texture::File::PNG::Write::process>>("process"_s)
+							.add_function_proxy<&stpg<&Tool::Texture::File::PNG::Write::estimate>>("estimate"_s);
 						s_PNG.add_space("Read"_s)
 							.add_function_proxy<&stpg<&Tool::Texture::File::PNG::Read::process>>("process"_s)
+							.add_function_proxy<&stpg<&Tool::Texture::File::PNG::Read::process_of>>("process_of"_s)
 							.add_function_proxy<&stpg<&Tool::Texture::File::PNG::Read::estimate>>("estimate"_s);
 					}
 				}
+				{
+					auto s_Atlas = s_Texture.add_space("Atlas"_s);
+					define_generic_class<Tool::Texture::Atlas::ExpandMethod>(s_Atlas, "ExpandMethod"_s);
+					{
+						auto s_Definition = s_Atlas.add_space("Definition"_s);
+						define_generic_class<Tool::Texture::Atlas::Definition::Atlas>(s_Definition, "Atlas"_s);
+					}
+					s_Atlas.add_space("Pack"_s)
+						.add_function_proxy<&stpg<&Tool::Texture::Atlas::Pack::process>>("process"_s);
+					s_Atlas.add_space("Compose"_s)
+						.add_function_proxy<&stpg<&Tool::Texture::Atlas::Compose::process>>("process"_s);
+					s_Atlas.add_space("Split"_s)
+						.add_function_proxy<&stpg<&Tool::Texture::Atlas::Split::process>>("process"_s);
+				}
 			}
 			// Wwise
 			{
@@ -770,7 +800,37 @@ namespace TwinStar::Kernel::Executor::Interface {
 									}
 								);
 							}
-						>>>("process"_s);
+						>>>("process"_s)
+						.add_function_proxy<&stpg<&normalized_lambda<
+							[] (
+							IByteStreamView &  data,
+							List<Path> const & resource,
+							Path const &       resource_directory,
+							Version const &    version
+						) -> Void {
+								Generalization::match<VersionPackage>(
+									version,
+									[&] <auto index, auto version> (ValuePackage<index>, ValuePackage<version>) {
+										Tool::Marmalade::DZip::Unpack<version>::process_partial(data, resource, resource_directory);
+									}
+								);
+							}
+						>>>("process_partial"_s)
+						.add_function_proxy<&stpg<&normalized_lambda<
+							[] (
+							Path const &       data_file,
+							List<Path> const & resource,
+							Path const &       resource_directory,
+							Version const &    version
+						) -> Void {
+								Generalization::match<VersionPackage>(
+									version,
+									[&] <auto index, auto version> (ValuePackage<index>, ValuePackage<version>) {
+										Tool::Marmalade::DZip::Unpack<version>::process_file_partial(data_file, resource, resource_directory);
+									}
+								);
+							}
+						>>>("process_file_partial"_s);
 				}
 			}
 			// PopCap
@@ -1138,6 +1198,46 @@ namespace TwinStar::Kernel::Executor::Interface {
 								);
 							}
 						>>>("process"_s);
+					{
+						auto s_Convert = s_Animation.add_space("Convert"_s);
+						auto s_Flash = s_Convert.add_space("Flash"_s);
+						s_Flash.add_space("From"_s)
+							.add_function_proxy<&stpg<&normalized_lambda<
+								[] (
+								AnimationDefinition const & definition,
+								JSON::Value &               extra,
+								Path const &                directory,
+								Version const &             version
+							) -> Void {
+									Generalization::match<VersionPackage>(
+										version,
+										[&] <auto index, auto version> (ValuePackage<index>, ValuePackage<version>) {
+											auto extra_value = Tool::PopCap::Animation::Convert::Flash::ExtraInformation{};
+											Tool::PopCap::Animation::Convert::Flash::From<version>::process(definition.template get_of_index<mbw<Size>(index)>(), extra_value, directory);
+											extra.from(extra_value);
+										}
+									);
+								}
+							>>>("process"_s);
+						s_Flash.add_space("To"_s)
+							.add_function_proxy<&stpg<&normalized_lambda<
+								[] (
+								AnimationDefinition & definition,
+								JSON::Value const &   extra,
+								Path const &          directory,
+								Version const &       version
+							) -> Void {
+									Generalization::match<VersionPackage>(
+										version,
+										[&] <auto index, auto version> (ValuePackage<index>, ValuePackage<version>) {
+											auto extra_value = Tool::PopCap::Animation::Convert::Flash::ExtraInformation{};
+											extra.to(extra_value);
+											Tool::PopCap::Animation::Convert::Flash::To<version>::process(definition.template set_of_index<mbw<Size>(index)>(), extra_value, directory);
+										}
+									);
+								}
+							>>>("process"_s);
+					}
 				}
 				{
 					using Tool::PopCap::ReAnimation::Version;
@@ -1457,12 +1557,13 @@ namespace TwinStar::Kernel::Executor::Interface {
 							IByteStreamView &      data,
 							PackageDefinition &    definition,
 							Optional<Path> const & resource_directory,
+							CByteListView const &  key,
 							Version const &        version
 						) -> Void {
 								Generalization::match<VersionPackage>(
 									version,
 									[&] <auto index, auto version> (ValuePackage<index>, ValuePackage<version>) {
-										Tool::PopCap::Package::Unpack<version>::process(data, definition.template set_of_index<mbw<Size>(index)>(), resource_directory);
+										Tool::PopCap::Package::Unpack<version>::process(data, definition.template set_of_index<mbw<Size>(index)>(), resource_directory, key);
 									}
 								);
 							}
@@ -1516,12 +1617,39 @@ namespace TwinStar::Kernel::Executor::Interface {
 								);
 							}
 						>>>("process"_s);
+					s_ResourceStreamGroup.add_space("PacketCache"_s)
+						.add_function_proxy<&stpg<&normalized_lambda<
+							[] (
+						) -> Size {
+								return Tool::PopCap::ResourceStreamGroup::g_packet_cache.budget();
+							}
+						>>>("budget"_s)
+						.add_function_proxy<&stpg<&normalized_lambda<
+							[] (
+						) -> Size {
+								return Tool::PopCap::ResourceStreamGroup::g_packet_cache.usage();
+							}
+						>>>("usage"_s)
+						.add_function_proxy<&stpg<&normalized_lambda<
+							[] (
+							Size const & budget
+						) -> Void {
+								return Tool::PopCap::ResourceStreamGroup::g_packet_cache.set_budget(budget);
+							}
+						>>>("set_budget"_s)
+						.add_function_proxy<&stpg<&normalized_lambda<
+							[] (
+						) -> Void {
+								return Tool::PopCap::ResourceStreamGroup::g_packet_cache.clear();
+							}
+						>>>("clear"_s);
 				}
 				{
 					using Tool::PopCap::ResourceStreamBundle::Version;
 					using Tool::PopCap::ResourceStreamBundle::VersionPackage;
 					using Tool::PopCap::ResourceStreamBundle::Definition;
 					using Tool::PopCap::ResourceStreamBundle::Manifest;
+					using Tool::PopCap::ResourceStreamBundle::Index;
 					using PackageDefinition = Variant<
 						typename Definition<VersionPackage::element<1_ixz>>::Package,
 						typename Definition<VersionPackage::element<2_ixz>>::Package,
@@ -1538,6 +1666,14 @@ namespace TwinStar::Kernel::Executor::Interface {
 						Optional<typename Manifest<VersionPackage::element<5_ixz>>::Package>,
 						Optional<typename Manifest<VersionPackage::element<6_ixz>>::Package>
 					>;
+					using PackageIndex = Variant<
+						typename Index<VersionPackage::element<1_ixz>>::Package,
+						typename Index<VersionPackage::element<2_ixz>>::Package,
+						typename Index<VersionPackage::element<3_ixz>>::Package,
+						typename Index<VersionPackage::element<4_ixz>>::Package,
+						typename Index<VersionPackage::element<5_ixz>>::Package,
+						typename Index<VersionPackage::element<6_ixz>>::Package
+					>;
 					auto s_ResourceStreamBundle = s_PopCap.add_space("ResourceStreamBundle"_s);
 					define_generic_class<Version>(s_ResourceStreamBundle, "Version"_s);
 					{
@@ -1550,6 +1686,11 @@ namespace TwinStar::Kernel::Executor::Interface {
 						auto c_PackageOptional = define_generic_class<PackageManifestOptional, GCDF::generic_mask>(s_Manifest, "PackageOptional"_s);
 						define_variant_class_version_method<Version, VersionPackage>(c_PackageOptional);
 					}
+					{
+						auto s_Index = s_ResourceStreamBundle.add_space("Index"_s);
+						auto c_Package = define_generic_class<PackageIndex, GCDF::generic_mask>(s_Index, "Package"_s);
+						define_variant_class_version_method<Version, VersionPackage>(c_Package);
+					}
 					s_ResourceStreamBundle.add_space("Pack"_s)
 						.add_function_proxy<&stpg<&normalized_lambda<
 							[] (
@@ -1568,7 +1709,25 @@ namespace TwinStar::Kernel::Executor::Interface {
 									}
 								);
 							}
-						>>>("process"_s);
+						>>>("process"_s)
+						.add_function_proxy<&stpg<&normalized_lambda<
+							[] (
+							Path const &                    data_file,
+							PackageDefinition const &       definition,
+							PackageManifestOptional const & manifest,
+							Path const &                    resource_directory,
+							Optional<Path> const &          packet_file,
+							Optional<Path> const &          new_packet_file,
+							Version const &                 version
+						) -> Void {
+								Generalization::match<VersionPackage>(
+									version,
+									[&] <auto index, auto version> (ValuePackage<index>, ValuePackage<version>) {
+										Tool::PopCap::ResourceStreamBundle::Pack<version>::process_file(data_file, definition.template get_of_index<mbw<Size>(index)>(), manifest.template get_of_index<mbw<Size>(index)>(), resource_directory, packet_file, new_packet_file);
+									}
+								);
+							}
+						>>>("process_file"_s);
 					s_ResourceStreamBundle.add_space("Unpack"_s)
 						.add_function_proxy<&stpg<&normalized_lambda<
 							[] (
@@ -1586,7 +1745,35 @@ namespace TwinStar::Kernel::Executor::Interface {
 									}
 								);
 							}
-						>>>("process"_s);
+						>>>("process"_s)
+						.add_function_proxy<&stpg<&normalized_lambda<
+							[] (
+							IByteStreamView & data,
+							PackageIndex &    index,
+							Version const &   version
+						) -> Void {
+								Generalization::match<VersionPackage>(
+									version,
+									[&] <auto index_, auto version> (ValuePackage<index_>, ValuePackage<version>) {
+										Tool::PopCap::ResourceStreamBundle::Unpack<version>::process_index(data, index.template set_of_index<mbw<Size>(index_)>());
+									}
+								);
+							}
+						>>>("process_index"_s)
+						.add_function_proxy<&stpg<&normalized_lambda<
+							[] (
+							Path const &    data_file,
+							PackageIndex &  index,
+							Version const & version
+						) -> Void {
+								Generalization::match<VersionPackage>(
+									version,
+									[&] <auto index_, auto version> (ValuePackage<index_>, ValuePackage<version>) {
+										Tool::PopCap::ResourceStreamBundle::Unpack<version>::process_index_file(data_file, index.template set_of_index<mbw<Size>(index_)>());
+									}
+								);
+							}
+						>>>("process_index_file"_s);
 				}
 				{
 					using Tool::PopCap::ResourceStreamBundlePatch::Version;
@@ -1655,6 +1842,13 @@ namespace TwinStar::Kernel::Executor::Interface {
 						.add_function_proxy<&stpg<&Tool::Miscellaneous::PvZ2CNCryptData::Decrypt::process>>("process"_s)
 						.add_function_proxy<&stpg<&Tool::Miscellaneous::PvZ2CNCryptData::Decrypt::estimate>>("estimate"_s);
 				}
+				{
+					auto s_PvZ2ResourceManifest = s_Miscellaneous.add_space("PvZ2ResourceManifest"_s);
+					s_PvZ2ResourceManifest.add_space("Encode"_s)
+						.add_function_proxy<&stpg<&Tool::Miscellaneous::PvZ2ResourceManifest::Encode::process>>("process"_s);
+					s_PvZ2ResourceManifest.add_space("Decode"_s)
+						.add_function_proxy<&stpg<&Tool::Miscellaneous::PvZ2ResourceManifest::Decode::process>>("process"_s);
+				}
 			}
 		}
 		// Miscellaneous
@@ -1798,6 +1992,38 @@ namespace TwinStar::Kernel::Executor::Interface {
 						}
 					>
 				>("cast_CharacterListView_to_JS_String"_s);
+			s_Miscellaneous.add_space("Tracer"_s)
+				.add_function_proxy<&stpg<&normalized_lambda<
+					[] (
+				) -> Boolean {
+						return g_tracer.enabled();
+					}
+				>>>("enabled"_s)
+				.add_function_proxy<&stpg<&normalized_lambda<
+					[] (
+					Boolean const & enabled
+				) -> Void {
+						return g_tracer.set_enabled(enabled);
+					}
+				>>>("set_enabled"_s)
+				.add_function_proxy<&stpg<&normalized_lambda<
+					[] (
+				) -> Void {
+						return g_tracer.clear();
+					}
+				>>>("clear"_s)
+				.add_function_proxy<&stpg<&normalized_lambda<
+					[] (
+				) -> JSON::Value {
+						return g_tracer.summary();
+					}
+				>>>("summary"_s)
+				.add_function_proxy<&stpg<&normalized_lambda<
+					[] (
+				) -> JSON::Value {
+						return g_tracer.export_chrome_trace();
+					}
+				>>>("export_chrome_trace"_s);
 			s_Miscellaneous.add_variable("g_version"_s, context.context().new_value(JavaScript::NativeValueHandler<Size>::new_instance_allocate(mbw<Size>(M_version))));
 			s_Miscellaneous.add_variable("g_context"_s, context.context().new_value(JavaScript::NativeValueHandler<Context>::new_reference(context)));
 		}
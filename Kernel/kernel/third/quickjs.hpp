@@ -53,6 +53,8 @@ namespace TwinStar::Kernel::Third::quickjs {
 
 	using JSPropertyEnum = ::JSPropertyEnum;
 
+	using JSAtom = ::JSAtom;
+
 	using JSModuleDef = ::JSModuleDef;
 
 	inline constexpr auto JS_NewRuntime = ::JS_NewRuntime;
@@ -103,8 +105,12 @@ namespace TwinStar::Kernel::Third::quickjs {
 
 	inline constexpr auto JS_IsFunction = ::JS_IsFunction;
 
+	inline constexpr auto JS_IsArray = ::JS_IsArray;
+
 	inline constexpr auto JS_ToBool = ::JS_ToBool;
 
+	inline constexpr auto JS_ToInt64 = ::JS_ToInt64;
+
 	inline constexpr auto JS_ToFloat64 = ::JS_ToFloat64;
 
 	inline constexpr auto JS_ToBigInt64 = ::JS_ToBigInt64;
@@ -139,6 +145,8 @@ namespace TwinStar::Kernel::Third::quickjs {
 
 	inline constexpr auto JS_DefinePropertyValue = ::JS_DefinePropertyValue;
 
+	inline constexpr auto JS_DefinePropertyValueUint32 = ::JS_DefinePropertyValueUint32;
+
 	inline constexpr auto JS_DefinePropertyGetSet = ::JS_DefinePropertyGetSet;
 
 	inline constexpr auto JS_DeleteProperty = ::JS_DeleteProperty;
@@ -147,6 +155,10 @@ namespace TwinStar::Kernel::Third::quickjs {
 
 	inline constexpr auto JS_GetProperty = ::JS_GetProperty;
 
+	inline constexpr auto JS_GetPropertyStr = ::JS_GetPropertyStr;
+
+	inline constexpr auto JS_GetPropertyUint32 = ::JS_GetPropertyUint32;
+
 	inline constexpr auto JS_SetProperty = ::JS_SetProperty;
 
 	inline constexpr auto JS_GetOwnPropertyNames = ::JS_GetOwnPropertyNames;
@@ -30,14 +30,24 @@ namespace TwinStar::Kernel::Third::zlib {
 
 	inline constexpr auto deflateEnd = ::deflateEnd;
 
+	inline constexpr auto deflateSetDictionary = ::deflateSetDictionary;
+
 	inline constexpr auto inflateInit2_ = ::inflateInit2_;
 
 	inline constexpr auto inflate = ::inflate;
 
 	inline constexpr auto inflateEnd = ::inflateEnd;
 
+	inline constexpr auto adler32 = ::adler32;
+
+	inline constexpr auto adler32_combine = ::adler32_combine;
+
+	inline constexpr auto crc32 = ::crc32;
+
 	inline constexpr auto Z_DEFLATED_ = Z_DEFLATED;
 
+	inline constexpr auto Z_BEST_SPEED_ = Z_BEST_SPEED;
+
 	inline constexpr auto Z_BEST_COMPRESSION_ = Z_BEST_COMPRESSION;
 
 	inline constexpr auto MAX_WBITS_ = MAX_WBITS;
@@ -56,6 +66,8 @@ namespace TwinStar::Kernel::Third::zlib {
 
 	inline constexpr auto Z_NO_FLUSH_ = Z_NO_FLUSH;
 
+	inline constexpr auto Z_SYNC_FLUSH_ = Z_SYNC_FLUSH;
+
 	inline constexpr auto Z_FINISH_ = Z_FINISH;
 
 	inline constexpr auto Z_OK_ = Z_OK;
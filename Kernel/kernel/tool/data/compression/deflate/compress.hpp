@@ -141,7 +141,10 @@ namespace TwinStar::Kernel::Tool::Data::Compression::Deflate {
 		) -> Void {
 			M_use_zps_of(raw);
 			M_use_zps_of(ripe);
-			return process_whole(raw, ripe, level, window_bits, memory_level, strategy, wrapper);
+			auto span = TraceSpan{"data.compression.deflate.compress"_sv};
+			process_whole(raw, ripe, level, window_bits, memory_level, strategy, wrapper);
+			span.set_byte(raw.position(), ripe.position());
+			return;
 		}
 
 		static auto estimate (
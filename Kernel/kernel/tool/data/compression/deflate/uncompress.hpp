@@ -88,7 +88,10 @@ namespace TwinStar::Kernel::Tool::Data::Compression::Deflate {
 		) -> Void {
 			M_use_zps_of(ripe);
 			M_use_zps_of(raw);
-			return process_whole(ripe, raw, window_bits, wrapper);
+			auto span = TraceSpan{"data.compression.deflate.uncompress"_sv};
+			process_whole(ripe, raw, window_bits, wrapper);
+			span.set_byte(ripe.position(), raw.position());
+			return;
 		}
 
 	};
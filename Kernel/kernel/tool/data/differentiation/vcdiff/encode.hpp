@@ -13,29 +13,218 @@ namespace TwinStar::Kernel::Tool::Data::Differentiation::VCDiff {
 
 		// ----------------
 
+		// NOTE : encoder output is written straight into the stream, instead of an intermediate std::string
+		class StreamSink :
+			public Third::open_vcdiff::OutputStringInterface {
+
+		protected:
+
+			OByteStreamView & m_stream;
+
+			Size m_begin_position;
+
+		public:
+
+			#pragma region structor
+
+			~StreamSink (
+			) override = default;
+
+			// ----------------
+
+			StreamSink (
+			) = delete;
+
+			StreamSink (
+				StreamSink const & that
+			) = delete;
+
+			StreamSink (
+				StreamSink && that
+			) = delete;
+
+			// ----------------
+
+			explicit StreamSink (
+				OByteStreamView & stream
+			) :
+				m_stream{stream},
+				m_begin_position{stream.position()} {
+			}
+
+			#pragma endregion
+
+			#pragma region operator
+
+			auto operator = (
+				StreamSink const & that
+			) -> StreamSink & = delete;
+
+			auto operator = (
+				StreamSink && that
+			) -> StreamSink & = delete;
+
+			#pragma endregion
+
+			#pragma region implement
+
+			auto append (
+				char const * s,
+				std::size_t  n
+			) -> StreamSink & override {
+				thiz.m_stream.write(CByteListView{cast_pointer<Byte>(make_pointer(s)), mbw<Size>(n)});
+				return thiz;
+			}
+
+			auto clear (
+			) -> void override {
+				thiz.m_stream.set_position(thiz.m_begin_position);
+				return;
+			}
+
+			auto push_back (
+				char c
+			) -> void override {
+				thiz.m_stream.write(self_cast<Byte>(c));
+				return;
+			}
+
+			auto ReserveAdditionalBytes (
+				std::size_t res_arg
+			) -> void override {
+				assert_test(thiz.m_stream.reserve() >= mbw<Size>(res_arg));
+				return;
+			}
+
+			auto size (
+			) const -> std::size_t override {
+				return (thiz.m_stream.position() - thiz.m_begin_position).value;
+			}
+
+			#pragma endregion
+
+		};
+
+		// ----------------
+
+		// NOTE
+		// the hashed dictionary over before is built once, then any number of after can be encoded against it
+		// the dictionary is read-only after initialization, so encode can be called from several threads at once
+		// the dictionary engine keeps its own copy of before, so before may be released once the session is constructed
+		class Session {
+
+		protected:
+
+			Third::open_vcdiff::HashedDictionary m_dictionary;
+
+			Boolean m_interleaved;
+
+		public:
+
+			#pragma region structor
+
+			~Session (
+			) = default;
+
+			// ----------------
+
+			Session (
+			) = delete;
+
+			Session (
+				Session const & that
+			) = delete;
+
+			Session (
+				Session && that
+			) = delete;
+
+			// ----------------
+
+			explicit Session (
+				CByteListView const & before,
+				Boolean const &       interleaved
+			) :
+				m_dictionary{cast_pointer<char>(as_variable_pointer(before.begin())).value, before.size().value},
+				m_interleaved{interleaved} {
+				auto state = thiz.m_dictionary.Init();
+				assert_test(state);
+			}
+
+			#pragma endregion
+
+			#pragma region operator
+
+			auto operator = (
+				Session const & that
+			) -> Session & = delete;
+
+			auto operator = (
+				Session && that
+			) -> Session & = delete;
+
+			#pragma endregion
+
+			#pragma region encode
+
+			auto encode_to (
+				CByteListView const &                       after,
+				Third::open_vcdiff::OutputStringInterface & output
+			) const -> Void {
+				auto state = bool{};
+				auto encoder = Third::open_vcdiff::VCDiffStreamingEncoder{&thiz.m_dictionary, !thiz.m_interleaved ? (Third::open_vcdiff::VCDiffFormatExtensionFlagValues::VCD_STANDARD_FORMAT) : (Third::open_vcdiff::VCDiffFormatExtensionFlagValues::VCD_FORMAT_INTERLEAVED), true};
+				state = encoder.StartEncodingToInterface(&output);
+				assert_test(state);
+				state = encoder.EncodeChunkToInterface(cast_pointer<char>(as_variable_pointer(after.begin())).value, after.size().value, &output);
+				assert_test(state);
+				state = encoder.FinishEncodingToInterface(&output);
+				assert_test(state);
+				return;
+			}
+
+			// ----------------
+
+			auto encode (
+				IByteStreamView & after,
+				OByteStreamView & patch
+			) const -> Void {
+				auto sink = StreamSink{patch};
+				thiz.encode_to(after.forward_view(after.reserve()), sink);
+				return;
+			}
+
+			// NOTE : the size of each patch is unknown before encoding, so every patch is collected in a growing buffer
+			auto encode_batch (
+				List<CByteListView> const & after,
+				List<ByteArray> &           patch
+			) const -> Void {
+				patch.allocate_full(after.size());
+				parallel_each(
+					after.size(),
+					[&] (Size const & index) {
+						auto patch_container = std::string{};
+						auto patch_container_sink = Third::open_vcdiff::OutputString<std::string>{&patch_container};
+						thiz.encode_to(after[index], patch_container_sink);
+						patch[index].assign(CByteListView{cast_pointer<Byte>(make_pointer(patch_container.data())), mbw<Size>(patch_container.size())});
+					}
+				);
+				return;
+			}
+
+			#pragma endregion
+
+		};
+
+		// ----------------
+
 		static auto process_whole (
 			IByteStreamView & before,
 			IByteStreamView & after,
 			OByteStreamView & patch,
 			Boolean const &   interleaved
 		) -> Void {
-			auto state = bool{};
-			auto patch_container = std::string{};
-			auto hashed_dictionary = Third::open_vcdiff::HashedDictionary{cast_pointer<char>(as_variable_pointer(before.current_pointer())).value, before.reserve().value};
-			auto encoder = Third::open_vcdiff::VCDiffStreamingEncoder{&hashed_dictionary, !interleaved ? (Third::open_vcdiff::VCDiffFormatExtensionFlagValues::VCD_STANDARD_FORMAT) : (Third::open_vcdiff::VCDiffFormatExtensionFlagValues::VCD_FORMAT_INTERLEAVED), true};
-			state = hashed_dictionary.Init();
-			assert_test(state);
-			state = encoder.StartEncoding(&patch_container);
-			assert_test(state);
-			state = encoder.EncodeChunk(cast_pointer<char>(as_variable_pointer(after.current_pointer())).value, after.reserve().value, &patch_container);
-			assert_test(state);
-			state = encoder.FinishEncoding(&patch_container);
-			assert_test(state);
-			before.forward(before.reserve());
-			after.forward(after.reserve());
-			for (auto & element : patch_container) {
-				patch.write(self_cast<Byte>(element));
-			}
+			auto session = Session{before.forward_view(before.reserve()), interleaved};
+			session.encode(after, patch);
 			return;
 		}
 
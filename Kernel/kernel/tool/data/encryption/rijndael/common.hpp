@@ -1,6 +1,14 @@
 #pragma once
 
 #include "kernel/utility/utility.hpp"
+#include <array>
+
+#if defined M_architecture_x86_32 || defined M_architecture_x86_64
+#include <wmmintrin.h>
+#if defined M_compiler_msvc
+#include <intrin.h>
+#endif
+#endif
 
 namespace TwinStar::Kernel::Tool::Data::Encryption::Rijndael {
 
@@ -24,6 +32,9 @@ namespace TwinStar::Kernel::Tool::Data::Encryption::Rijndael {
 			0x00_c, 0x00_c, 0x00_c, 0x00_c, 0x00_c, 0x00_c, 0x00_c, 0x00_c,
 		}};
 
+		// NOTE : data is split into segments of this many blocks, each segment is processed by one worker
+		inline static constexpr auto k_segment_block_count = 4096_sz;
+
 		// ----------------
 
 		static constexpr auto is_valid_block_size (
@@ -32,6 +43,227 @@ namespace TwinStar::Kernel::Tool::Data::Encryption::Rijndael {
 			return value == 16_sz || value == 24_sz || value == 32_sz;
 		}
 
+		// ----------------
+
+		// NOTE : byte view of the block that come before the segment, the iv for the first segment
+		static auto make_segment_chain (
+			CByteListView const & data,
+			CByteListView const & iv,
+			Size const &          block_size
+		) -> ByteArray {
+			auto segment_size = k_segment_block_count * block_size;
+			auto segment_count = (data.size() + segment_size - 1_sz) / segment_size;
+			auto chain = ByteArray{segment_count * block_size};
+			for (auto & segment_index : SizeRange{segment_count}) {
+				Range::assign_from(chain.sub(segment_index * block_size, block_size), segment_index == k_begin_index ? (iv.head(block_size)) : (data.sub(segment_index * segment_size - block_size, block_size)));
+			}
+			return chain;
+		}
+
+		// ----------------
+
+		#if defined M_architecture_x86_32 || defined M_architecture_x86_64
+
+		// NOTE
+		// AES-NI path, only for 16 byte block
+		// round key is expanded by the standard key schedule with the s-box of the library, so every key size share the same code
+		struct AESNI {
+
+			inline static constexpr auto k_maximum_round_count = ZSize{14};
+
+			// NOTE : generate by the multiplicative inverse in GF(2^8) followed by the affine transform
+			inline static constexpr auto k_substitution_box = [] {
+				auto rotate = [] (ZByte const & value, int const & shift) -> ZByte {
+					return static_cast<ZByte>((value << shift) | (value >> (8 - shift)));
+				};
+				auto box = std::array<ZByte, 256>{};
+				auto p = ZByte{1};
+				auto q = ZByte{1};
+				do {
+					p = static_cast<ZByte>(p ^ (p << 1) ^ ((p & 0x80) != 0 ? 0x1B : 0x00));
+					q = static_cast<ZByte>(q ^ (q << 1));
+					q = static_cast<ZByte>(q ^ (q << 2));
+					q = static_cast<ZByte>(q ^ (q << 4));
+					if ((q & 0x80) != 0) {
+						q = static_cast<ZByte>(q ^ 0x09);
+					}
+					box[p] = static_cast<ZByte>(q ^ rotate(q, 1) ^ rotate(q, 2) ^ rotate(q, 3) ^ rotate(q, 4) ^ 0x63);
+				}
+				while (p != 1);
+				box[0] = 0x63;
+				return box;
+			}();
+
+			// ----------------
+
+			static auto supported (
+			) -> Boolean {
+				#if defined M_compiler_msvc
+				int information[4] = {};
+				__cpuid(information, 1);
+				return mbw<Boolean>(((information[2] >> 25) & 1) != 0);
+				#endif
+				#if defined M_compiler_clang
+				return mbw<Boolean>(__builtin_cpu_supports("aes"));
+				#endif
+			}
+
+			// ----------------
+
+			// NOTE : round_key must hold (k_maximum_round_count + 1) * 16 byte, return the round count
+			static auto expand_key (
+				ZByte const * key,
+				ZSize const & key_size,
+				ZByte *       round_key
+			) -> ZSize {
+				auto word_count = key_size / 4;
+				auto round_count = word_count + 6;
+				auto round_constant = ZByte{0x01};
+				std::memcpy(round_key, key, key_size);
+				for (auto word_index = word_count; word_index < 4 * (round_count + 1); ++word_index) {
+					ZByte word[4];
+					std::memcpy(word, round_key + (word_index - 1) * 4, 4);
+					if (word_index % word_count == 0) {
+						auto first = word[0];
+						word[0] = static_cast<ZByte>(k_substitution_box[word[1]] ^ round_constant);
+						word[1] = k_substitution_box[word[2]];
+						word[2] = k_substitution_box[word[3]];
+						word[3] = k_substitution_box[first];
+						round_constant = static_cast<ZByte>((round_constant << 1) ^ ((round_constant & 0x80) != 0 ? 0x1B : 0x00));
+					}
+					else if (word_count > 6 && word_index % word_count == 4) {
+						for (auto & element : word) {
+							element = k_substitution_box[element];
+						}
+					}
+					for (auto byte_index = ZSize{0}; byte_index < 4; ++byte_index) {
+						round_key[word_index * 4 + byte_index] = static_cast<ZByte>(round_key[(word_index - word_count) * 4 + byte_index] ^ word[byte_index]);
+					}
+				}
+				return round_count;
+			}
+
+			// ----------------
+
+			// NOTE : intrinsic can not be used in lambda, which does not inherit the target attribute
+			#if defined M_compiler_clang
+			__attribute__((target("aes,sse2")))
+			#endif
+			static auto encrypt_block (
+				__m128i const * key,
+				ZSize const &   round_count,
+				__m128i         block
+			) -> __m128i {
+				block = _mm_xor_si128(block, key[0]);
+				for (auto round_index = ZSize{1}; round_index < round_count; ++round_index) {
+					block = _mm_aesenc_si128(block, key[round_index]);
+				}
+				return _mm_aesenclast_si128(block, key[round_count]);
+			}
+
+			#if defined M_compiler_clang
+			__attribute__((target("aes,sse2")))
+			#endif
+			static auto encrypt (
+				ZByte const * round_key,
+				ZSize const & round_count,
+				ZByte const * input,
+				ZByte *       output,
+				ZSize const & block_count,
+				ZByte *       chain
+			) -> Void {
+				__m128i key[k_maximum_round_count + 1];
+				for (auto round_index = ZSize{0}; round_index <= round_count; ++round_index) {
+					key[round_index] = _mm_loadu_si128(reinterpret_cast<__m128i const *>(round_key + round_index * 16));
+				}
+				// NOTE : cbc if chain is given, otherwise ecb
+				if (chain != nullptr) {
+					auto previous = _mm_loadu_si128(reinterpret_cast<__m128i const *>(chain));
+					for (auto block_index = ZSize{0}; block_index < block_count; ++block_index) {
+						previous = encrypt_block(key, round_count, _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(input + block_index * 16)), previous));
+						_mm_storeu_si128(reinterpret_cast<__m128i *>(output + block_index * 16), previous);
+					}
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(chain), previous);
+				}
+				else {
+					for (auto block_index = ZSize{0}; block_index < block_count; ++block_index) {
+						_mm_storeu_si128(reinterpret_cast<__m128i *>(output + block_index * 16), encrypt_block(key, round_count, _mm_loadu_si128(reinterpret_cast<__m128i const *>(input + block_index * 16))));
+					}
+				}
+				return;
+			}
+
+			#if defined M_compiler_clang
+			__attribute__((target("aes,sse2")))
+			#endif
+			static auto decrypt (
+				ZByte const * round_key,
+				ZSize const & round_count,
+				ZByte const * input,
+				ZByte *       output,
+				ZSize const & block_count,
+				ZByte const * chain
+			) -> Void {
+				__m128i key[k_maximum_round_count + 1];
+				key[0] = _mm_loadu_si128(reinterpret_cast<__m128i const *>(round_key + round_count * 16));
+				for (auto round_index = ZSize{1}; round_index < round_count; ++round_index) {
+					key[round_index] = _mm_aesimc_si128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(round_key + (round_count - round_index) * 16)));
+				}
+				key[round_count] = _mm_loadu_si128(reinterpret_cast<__m128i const *>(round_key));
+				// NOTE : four independent block in flight to hide the latency of aesdec
+				auto block_index = ZSize{0};
+				auto previous = chain != nullptr ? (_mm_loadu_si128(reinterpret_cast<__m128i const *>(chain))) : (_mm_setzero_si128());
+				for (; block_index + 4 <= block_count; block_index += 4) {
+					auto source_0 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(input + (block_index + 0) * 16));
+					auto source_1 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(input + (block_index + 1) * 16));
+					auto source_2 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(input + (block_index + 2) * 16));
+					auto source_3 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(input + (block_index + 3) * 16));
+					auto block_0 = _mm_xor_si128(source_0, key[0]);
+					auto block_1 = _mm_xor_si128(source_1, key[0]);
+					auto block_2 = _mm_xor_si128(source_2, key[0]);
+					auto block_3 = _mm_xor_si128(source_3, key[0]);
+					for (auto round_index = ZSize{1}; round_index < round_count; ++round_index) {
+						block_0 = _mm_aesdec_si128(block_0, key[round_index]);
+						block_1 = _mm_aesdec_si128(block_1, key[round_index]);
+						block_2 = _mm_aesdec_si128(block_2, key[round_index]);
+						block_3 = _mm_aesdec_si128(block_3, key[round_index]);
+					}
+					block_0 = _mm_aesdeclast_si128(block_0, key[round_count]);
+					block_1 = _mm_aesdeclast_si128(block_1, key[round_count]);
+					block_2 = _mm_aesdeclast_si128(block_2, key[round_count]);
+					block_3 = _mm_aesdeclast_si128(block_3, key[round_count]);
+					if (chain != nullptr) {
+						block_0 = _mm_xor_si128(block_0, previous);
+						block_1 = _mm_xor_si128(block_1, source_0);
+						block_2 = _mm_xor_si128(block_2, source_1);
+						block_3 = _mm_xor_si128(block_3, source_2);
+						previous = source_3;
+					}
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(output + (block_index + 0) * 16), block_0);
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(output + (block_index + 1) * 16), block_1);
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(output + (block_index + 2) * 16), block_2);
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(output + (block_index + 3) * 16), block_3);
+				}
+				for (; block_index < block_count; ++block_index) {
+					auto source = _mm_loadu_si128(reinterpret_cast<__m128i const *>(input + block_index * 16));
+					auto block = _mm_xor_si128(source, key[0]);
+					for (auto round_index = ZSize{1}; round_index < round_count; ++round_index) {
+						block = _mm_aesdec_si128(block, key[round_index]);
+					}
+					block = _mm_aesdeclast_si128(block, key[round_count]);
+					if (chain != nullptr) {
+						block = _mm_xor_si128(block, previous);
+						previous = source;
+					}
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(output + block_index * 16), block);
+				}
+				return;
+			}
+
+		};
+
+		#endif
+
 	};
 
 }
@@ -30,12 +30,51 @@ namespace TwinStar::Kernel::Tool::Data::Encryption::Rijndael {
 			auto iv_view = mode == Mode::Constant::ecb() ? (k_empty_iv.view().head(block_size)) : (iv.view());
 			auto cipher_size = cipher.reserve();
 			if (cipher_size != k_none_size) {
+				auto cipher_data = cipher.forward_view(cipher_size);
+				auto plain_data = plain.forward_view(cipher_size);
+				// NOTE : ecb and cbc decrypt block are independent once the preceding cipher block is known, so segments are decrypted concurrently
+				if (mode == Mode::Constant::ecb() || mode == Mode::Constant::cbc()) {
+					auto segment_size = k_segment_block_count * block_size;
+					auto segment_count = (cipher_size + segment_size - 1_sz) / segment_size;
+					auto chain = make_segment_chain(cipher_data, to_byte_view(iv_view), block_size);
+					#if defined M_architecture_x86_32 || defined M_architecture_x86_64
+					if (block_size == 16_sz && AESNI::supported()) {
+						auto round_key = StaticByteArray<mbw<Size>((AESNI::k_maximum_round_count + 1) * 16)>{};
+						auto round_count = AESNI::expand_key(cast_pointer<ZByte>(key.begin()).value, key_size.value, cast_pointer<ZByte>(round_key.begin()).value);
+						parallel_each(
+							segment_count,
+							[&] (Size const & segment_index) {
+								auto segment_begin = segment_index * segment_size;
+								auto segment_block_count = minimum(segment_size, cipher_size - segment_begin) / block_size;
+								AESNI::decrypt(
+									cast_pointer<ZByte>(round_key.begin()).value,
+									round_count,
+									cast_pointer<ZByte>(cipher_data.begin() + segment_begin).value,
+									cast_pointer<ZByte>(plain_data.begin() + segment_begin).value,
+									segment_block_count.value,
+									mode == Mode::Constant::cbc() ? (cast_pointer<ZByte>(chain.begin() + segment_index * block_size).value) : (nullptr)
+								);
+							}
+						);
+						return;
+					}
+					#endif
+					parallel_each(
+						segment_count,
+						[&] (Size const & segment_index) {
+							auto segment_begin = segment_index * segment_size;
+							auto segment_length = minimum(segment_size, cipher_size - segment_begin);
+							auto rijndael = Third::Rijndael::CRijndael{};
+							rijndael.MakeKey(cast_pointer<char>(key.begin()).value, cast_pointer<char>(chain.begin() + segment_index * block_size).value, static_cast<int>(key_size.value), static_cast<int>(block_size.value));
+							rijndael.Decrypt(cast_pointer<char>(cipher_data.begin() + segment_begin).value, cast_pointer<char>(plain_data.begin() + segment_begin).value, segment_length.value, static_cast<int>(mode.value));
+						}
+					);
+					return;
+				}
 				auto rijndael = Third::Rijndael::CRijndael{};
 				rijndael.MakeKey(cast_pointer<char>(key.begin()).value, cast_pointer<char>(iv_view.begin()).value, static_cast<int>(key_size.value), static_cast<int>(block_size.value));
-				rijndael.Decrypt(cast_pointer<char>(cipher.current_pointer()).value, cast_pointer<char>(plain.current_pointer()).value, cipher.reserve().value, static_cast<int>(mode.value));
+				rijndael.Decrypt(cast_pointer<char>(cipher_data.begin()).value, cast_pointer<char>(plain_data.begin()).value, cipher_size.value, static_cast<int>(mode.value));
 			}
-			cipher.forward(cipher_size);
-			plain.forward(cipher_size);
 			return;
 		}
 
@@ -12,36 +12,67 @@ namespace TwinStar::Kernel::Tool::Data::Encryption::XOR {
 
 		// ----------------
 
-		static auto process_whole (
-			IByteStreamView &     plain,
-			OByteStreamView &     cipher,
-			CByteListView const & key
+		inline static constexpr auto k_word_size = mbw<Size>(sizeof(ZIntegerU64));
+
+		inline static constexpr auto k_pattern_size_bound = 256_sz;
+
+		// ----------------
+
+		// NOTE
+		// key is repeated into a pattern whose size is a multiple of both the key size and the word size
+		// so every pattern-sized block xor with the same words, the result is identical to byte-wise xor for any key size
+		static auto process_view (
+			CByteListView const & plain,
+			VByteListView const & cipher,
+			CByteListView const & key,
+			Size const &          key_index
 		) -> Void {
+			assert_test(cipher.size() == plain.size());
 			if (key.size() == 0_sz) {
-				while (!plain.full()) {
-					cipher.write(plain.read_of());
-				}
+				Range::assign_from(cipher, plain);
+				return;
 			}
-			else if (key.size() == 1_sz) {
-				while (!plain.full()) {
-					cipher.write(plain.read_of() ^ key.first());
-				}
+			auto pattern_size = key.size() * k_word_size * maximum(k_pattern_size_bound / (key.size() * k_word_size), 1_sz);
+			auto pattern = ByteArray{pattern_size};
+			for (auto & index : SizeRange{pattern_size}) {
+				pattern[index] = key[(key_index + index) % key.size()];
 			}
-			else {
-				auto key_index = key.begin_index();
-				while (!plain.full()) {
-					cipher.write(plain.read_of() ^ key[key_index]);
-					++key_index;
-					if (key_index == key.end_index()) {
-						key_index = key.begin_index();
-					}
+			auto plain_pointer = cast_pointer<ZByte>(plain.begin()).value;
+			auto cipher_pointer = cast_pointer<ZByte>(cipher.begin()).value;
+			auto pattern_pointer = cast_pointer<ZByte>(pattern.begin()).value;
+			auto size = plain.size().value;
+			auto position = ZSize{0};
+			while (position + pattern_size.value <= size) {
+				for (auto word_position = ZSize{0}; word_position < pattern_size.value; word_position += k_word_size.value) {
+					auto plain_word = ZIntegerU64{};
+					auto pattern_word = ZIntegerU64{};
+					std::memcpy(&plain_word, plain_pointer + position + word_position, k_word_size.value);
+					std::memcpy(&pattern_word, pattern_pointer + word_position, k_word_size.value);
+					plain_word ^= pattern_word;
+					std::memcpy(cipher_pointer + position + word_position, &plain_word, k_word_size.value);
 				}
+				position += pattern_size.value;
+			}
+			for (auto pattern_position = ZSize{0}; position < size; ++position, ++pattern_position) {
+				cipher_pointer[position] = static_cast<ZByte>(plain_pointer[position] ^ pattern_pointer[pattern_position]);
 			}
 			return;
 		}
 
 		// ----------------
 
+		static auto process_whole (
+			IByteStreamView &     plain,
+			OByteStreamView &     cipher,
+			CByteListView const & key
+		) -> Void {
+			auto size = plain.reserve();
+			process_view(plain.forward_view(size), cipher.forward_view(size), key, k_begin_index);
+			return;
+		}
+
+		// ----------------
+
 		static auto process (
 			IByteStreamView &     plain_,
 			OByteStreamView &     cipher_,
@@ -12,12 +12,15 @@ namespace TwinStar::Kernel::Tool::Data::Hash::FNV {
 
 		// ----------------
 
+		inline static constexpr auto k_file_block_size = 0x100000_sz;
+
+		// ----------------
+
 		template <auto mode, auto bit_count> requires
 			CategoryConstraint<>
 			&& (IsSameV<mode, Mode>)
 			&& (IsSameV<bit_count, BitCount>)
-		static auto process_whole_integer (
-			CByteListView const &                  data,
+		static auto initialize_integer (
 			typename Parameter<bit_count>::Value & value
 		) -> Void {
 			using Parameter = Parameter<bit_count>;
@@ -27,6 +30,18 @@ namespace TwinStar::Kernel::Tool::Data::Hash::FNV {
 			if constexpr (mode == Mode::Constant::m_1() || mode == Mode::Constant::m_1a()) {
 				value = Parameter::offset;
 			}
+			return;
+		}
+
+		template <auto mode, auto bit_count> requires
+			CategoryConstraint<>
+			&& (IsSameV<mode, Mode>)
+			&& (IsSameV<bit_count, BitCount>)
+		static auto update_integer (
+			CByteListView const &                  data,
+			typename Parameter<bit_count>::Value & value
+		) -> Void {
+			using Parameter = Parameter<bit_count>;
 			for (auto & element : data) {
 				if constexpr (mode == Mode::Constant::m_0()) {
 					value *= Parameter::prime;
@@ -44,11 +59,29 @@ namespace TwinStar::Kernel::Tool::Data::Hash::FNV {
 			return;
 		}
 
-		static auto process_whole (
-			CByteListView const & data,
-			ByteArray &           value,
-			Mode const &          mode,
-			BitCount const &      bit_count
+		template <auto mode, auto bit_count> requires
+			CategoryConstraint<>
+			&& (IsSameV<mode, Mode>)
+			&& (IsSameV<bit_count, BitCount>)
+		static auto process_whole_integer (
+			CByteListView const &                  data,
+			typename Parameter<bit_count>::Value & value
+		) -> Void {
+			initialize_integer<mode, bit_count>(value);
+			update_integer<mode, bit_count>(data, value);
+			return;
+		}
+
+		// ----------------
+
+		// NOTE : call executor(ValuePackage<mode>{}, ValuePackage<bit_count>{}) with the matched constant
+		template <typename Executor> requires
+			CategoryConstraint<IsPureInstance<Executor>>
+			&& (IsGenericCallable<Executor>)
+		static auto match_parameter (
+			Mode const &     mode,
+			BitCount const & bit_count,
+			Executor const & executor
 		) -> Void {
 			Generalization::match<ValuePackage<
 				Mode::Constant::m_0(),
@@ -64,10 +97,7 @@ namespace TwinStar::Kernel::Tool::Data::Hash::FNV {
 						bit_count,
 						// TODO : compiler error if use same name
 						[&] <auto index_, auto bit_count_> (ValuePackage<index_>, ValuePackage<bit_count_>) {
-							auto value_integer = typename Parameter<bit_count_>::Value{};
-							process_whole_integer<mode, bit_count_>(data, value_integer);
-							value.allocate(k_type_size<typename Parameter<bit_count_>::Value>);
-							OByteStreamView{value}.write(value_integer);
+							executor(ValuePackage<mode>{}, ValuePackage<bit_count_>{});
 						}
 					);
 				}
@@ -77,6 +107,168 @@ namespace TwinStar::Kernel::Tool::Data::Hash::FNV {
 
 		// ----------------
 
+		class Hasher {
+
+		protected:
+
+			Mode m_mode;
+
+			BitCount m_bit_count;
+
+			IntegerU64 m_value;
+
+		public:
+
+			#pragma region structor
+
+			~Hasher (
+			) = default;
+
+			// ----------------
+
+			Hasher (
+			) = delete;
+
+			Hasher (
+				Hasher const & that
+			) = default;
+
+			Hasher (
+				Hasher && that
+			) = default;
+
+			// ----------------
+
+			explicit Hasher (
+				Mode const &     mode,
+				BitCount const & bit_count
+			) :
+				m_mode{mode},
+				m_bit_count{bit_count},
+				m_value{} {
+				thiz.reset();
+			}
+
+			#pragma endregion
+
+			#pragma region operator
+
+			auto operator = (
+				Hasher const & that
+			) -> Hasher & = default;
+
+			auto operator = (
+				Hasher && that
+			) -> Hasher & = default;
+
+			#pragma endregion
+
+			#pragma region process
+
+			auto reset (
+			) -> Void {
+				match_parameter(
+					thiz.m_mode,
+					thiz.m_bit_count,
+					[&] <auto mode, auto bit_count> (ValuePackage<mode>, ValuePackage<bit_count>) {
+						auto value = typename Parameter<bit_count>::Value{};
+						initialize_integer<mode, bit_count>(value);
+						thiz.m_value = cbw<IntegerU64>(value);
+					}
+				);
+				return;
+			}
+
+			auto update (
+				CByteListView const & data
+			) -> Void {
+				match_parameter(
+					thiz.m_mode,
+					thiz.m_bit_count,
+					[&] <auto mode, auto bit_count> (ValuePackage<mode>, ValuePackage<bit_count>) {
+						auto value = cbw<typename Parameter<bit_count>::Value>(thiz.m_value);
+						update_integer<mode, bit_count>(data, value);
+						thiz.m_value = cbw<IntegerU64>(value);
+					}
+				);
+				return;
+			}
+
+			auto finish (
+				ByteArray & value
+			) -> Void {
+				match_parameter(
+					thiz.m_mode,
+					thiz.m_bit_count,
+					[&] <auto mode, auto bit_count> (ValuePackage<mode>, ValuePackage<bit_count>) {
+						value.allocate(k_type_size<typename Parameter<bit_count>::Value>);
+						OByteStreamView{value}.write(cbw<typename Parameter<bit_count>::Value>(thiz.m_value));
+					}
+				);
+				return;
+			}
+
+			#pragma endregion
+
+		};
+
+		// ----------------
+
+		static auto process_whole (
+			CByteListView const & data,
+			ByteArray &           value,
+			Mode const &          mode,
+			BitCount const &      bit_count
+		) -> Void {
+			match_parameter(
+				mode,
+				bit_count,
+				[&] <auto mode_, auto bit_count_> (ValuePackage<mode_>, ValuePackage<bit_count_>) {
+					auto value_integer = typename Parameter<bit_count_>::Value{};
+					process_whole_integer<mode_, bit_count_>(data, value_integer);
+					value.allocate(k_type_size<typename Parameter<bit_count_>::Value>);
+					OByteStreamView{value}.write(value_integer);
+				}
+			);
+			return;
+		}
+
+		static auto process_file_whole (
+			Path const &     data_file,
+			ByteArray &      value,
+			Mode const &     mode,
+			BitCount const & bit_count
+		) -> Void {
+			auto hasher = Hasher{mode, bit_count};
+			FileSystem::read_block_file(
+				data_file,
+				k_file_block_size,
+				[&] (CByteListView const & block) {
+					hasher.update(block);
+				}
+			);
+			hasher.finish(value);
+			return;
+		}
+
+		static auto process_file_batch_whole (
+			List<Path> const & data_file,
+			List<ByteArray> &  value,
+			Mode const &       mode,
+			BitCount const &   bit_count
+		) -> Void {
+			value.allocate_full(data_file.size());
+			parallel_each(
+				data_file.size(),
+				[&] (Size const & index) {
+					process_file_whole(data_file[index], value[index], mode, bit_count);
+				}
+			);
+			return;
+		}
+
+		// ----------------
+
 		static auto process (
 			CByteListView const & data,
 			ByteArray &           value,
@@ -87,6 +279,26 @@ namespace TwinStar::Kernel::Tool::Data::Hash::FNV {
 			return process_whole(data, value, mode, bit_count);
 		}
 
+		static auto process_file (
+			Path const &     data_file,
+			ByteArray &      value,
+			Mode const &     mode,
+			BitCount const & bit_count
+		) -> Void {
+			restruct(value);
+			return process_file_whole(data_file, value, mode, bit_count);
+		}
+
+		static auto process_file_batch (
+			List<Path> const & data_file,
+			List<ByteArray> &  value,
+			Mode const &       mode,
+			BitCount const &   bit_count
+		) -> Void {
+			restruct(value);
+			return process_file_batch_whole(data_file, value, mode, bit_count);
+		}
+
 	};
 
 }
@@ -13,12 +13,119 @@ namespace TwinStar::Kernel::Tool::Data::Hash::MD5 {
 
 		// ----------------
 
+		inline static constexpr auto k_file_block_size = 0x100000_sz;
+
+		// ----------------
+
+		class Hasher {
+
+		protected:
+
+			Third::md5::MD5 m_generator;
+
+		public:
+
+			#pragma region structor
+
+			~Hasher (
+			) = default;
+
+			// ----------------
+
+			Hasher (
+			) :
+				m_generator{std::span<Third::md5::byte const>{}} {
+			}
+
+			Hasher (
+				Hasher const & that
+			) = default;
+
+			Hasher (
+				Hasher && that
+			) = default;
+
+			#pragma endregion
+
+			#pragma region operator
+
+			auto operator = (
+				Hasher const & that
+			) -> Hasher & = default;
+
+			auto operator = (
+				Hasher && that
+			) -> Hasher & = default;
+
+			#pragma endregion
+
+			#pragma region process
+
+			auto reset (
+			) -> Void {
+				thiz.m_generator = Third::md5::MD5{std::span<Third::md5::byte const>{}};
+				return;
+			}
+
+			auto update (
+				CByteListView const & data
+			) -> Void {
+				thiz.m_generator.update(std::span{cast_pointer<Third::md5::byte>(data.begin()).value, data.size().value});
+				return;
+			}
+
+			// NOTE : a copy of the generator is finalized, since the padding overwrite its input buffer, so more data can be appended after finish
+			auto finish (
+				ByteArray & value
+			) const -> Void {
+				auto generator = thiz.m_generator;
+				value.assign(CByteListView{cast_pointer<Byte>(make_pointer(generator.getDigest())), 16_sz});
+				return;
+			}
+
+			#pragma endregion
+
+		};
+
+		// ----------------
+
 		static auto process_whole (
 			CByteListView const & data,
 			ByteArray &           value
 		) -> Void {
-			auto generator = Third::md5::MD5{std::span{cast_pointer<Third::md5::byte>(data.begin()).value, data.size().value}};
-			value.assign(CByteListView{cast_pointer<Byte>(make_pointer(generator.getDigest())), 16_sz});
+			auto hasher = Hasher{};
+			hasher.update(data);
+			hasher.finish(value);
+			return;
+		}
+
+		static auto process_file_whole (
+			Path const & data_file,
+			ByteArray &  value
+		) -> Void {
+			auto hasher = Hasher{};
+			FileSystem::read_block_file(
+				data_file,
+				k_file_block_size,
+				[&] (CByteListView const & block) {
+					hasher.update(block);
+				}
+			);
+			hasher.finish(value);
+			return;
+		}
+
+		static auto process_file_batch_whole (
+			List<Path> const & data_file,
+			List<ByteArray> &  value
+		) -> Void {
+			value.allocate_full(data_file.size());
+			parallel_each(
+				data_file.size(),
+				[&] (Size const & index) {
+					process_file_whole(data_file[index], value[index]);
+				}
+			);
 			return;
 		}
 
@@ -32,6 +139,22 @@ namespace TwinStar::Kernel::Tool::Data::Hash::MD5 {
 			return process_whole(data, value);
 		}
 
+		static auto process_file (
+			Path const & data_file,
+			ByteArray &  value
+		) -> Void {
+			restruct(value);
+			return process_file_whole(data_file, value);
+		}
+
+		static auto process_file_batch (
+			List<Path> const & data_file,
+			List<ByteArray> &  value
+		) -> Void {
+			restruct(value);
+			return process_file_batch_whole(data_file, value);
+		}
+
 	};
 
 }
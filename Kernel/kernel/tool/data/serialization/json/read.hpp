@@ -18,7 +18,11 @@ namespace TwinStar::Kernel::Tool::Data::Serialization::JSON {
 			Value &                value
 		) -> Void {
 			// TODO : static
-			thread_local auto buffer = CharacterArray{0x10000_sz};
+			thread_local auto buffer = [] {
+				// NOTE : the buffer outlive any arena, never take memory from it
+				auto arena_scope = ArenaScope{k_null};
+				return CharacterArray{0x10000_sz};
+			}();
 			thread_local auto buffer_stream = OCharacterStreamView{buffer};
 			while (k_true) {
 				switch (auto character = data.read_of(); character.value) {
@@ -1,10 +1,7 @@
 #pragma once
 
-// TODO : refactor, use stream style api ?
-
 #include "kernel/utility/utility.hpp"
 #include "kernel/tool/data/serialization/xml/common.hpp"
-#include "kernel/third/tinyxml2.hpp"
 
 namespace TwinStar::Kernel::Tool::Data::Serialization::XML {
 
@@ -15,49 +12,467 @@ namespace TwinStar::Kernel::Tool::Data::Serialization::XML {
 
 		// ----------------
 
-		static auto convert_node (
-			ZPointer<Third::tinyxml2::XMLNode const> const & raw_node,
-			Node &                                           node
-		) -> Void {
-			if (auto raw_element = raw_node->ToElement()) {
-				node.set_element();
-				auto & node_value = node.get_element();
-				node_value.name = make_string_view(raw_element->Name());
-				{
-					auto attribute_count = k_none_size;
-					for (auto raw_attribute = raw_element->FirstAttribute(); raw_attribute; raw_attribute = raw_attribute->Next()) {
-						++attribute_count;
+		// NOTE
+		// pull parser, every call of next read one event from the data, no document tree is built
+		// name is a view of the data, attribute value and text are decoded into an internal buffer if they contain entity or carriage return, the views keep valid until the next call of next
+		// the rule follow the tinyxml2 parser : leading utf-8 bom is skipped, whitespace-only text is skipped, entity and newline are normalized, unknown entity is kept as-is, declaration and doctype are skipped
+		class Reader {
+
+		protected:
+
+			CStringView m_data;
+
+			Size m_position;
+
+			List<CStringView> m_name_stack;
+
+			Boolean m_root_found;
+
+			Boolean m_element_end_pending;
+
+			CStringView m_name;
+
+			Map<CStringView, CStringView> m_attribute;
+
+			CStringView m_value;
+
+			Boolean m_cdata;
+
+			String m_buffer;
+
+		public:
+
+			#pragma region structor
+
+			~Reader (
+			) = default;
+
+			// ----------------
+
+			Reader (
+			) = delete;
+
+			Reader (
+				Reader const & that
+			) = delete;
+
+			Reader (
+				Reader && that
+			) = delete;
+
+			// ----------------
+
+			explicit Reader (
+				CStringView const & data
+			) :
+				m_data{data},
+				m_position{k_begin_index},
+				m_name_stack{},
+				m_root_found{k_false},
+				m_element_end_pending{k_false},
+				m_name{},
+				m_attribute{},
+				m_value{},
+				m_cdata{k_false},
+				m_buffer{} {
+				if (thiz.test_string("\xEF\xBB\xBF"_sv)) {
+					thiz.m_position += 3_sz;
+				}
+			}
+
+			#pragma endregion
+
+			#pragma region operator
+
+			auto operator = (
+				Reader const & that
+			) -> Reader & = delete;
+
+			auto operator = (
+				Reader && that
+			) -> Reader & = delete;
+
+			#pragma endregion
+
+			#pragma region event
+
+			auto next (
+			) -> EventType {
+				if (thiz.m_element_end_pending) {
+					thiz.m_element_end_pending = k_false;
+					thiz.m_name = thiz.m_name_stack.last();
+					thiz.m_name_stack.remove_tail();
+					return EventType::Constant::element_end();
+				}
+				while (k_true) {
+					auto text_begin = thiz.m_position;
+					thiz.skip_space();
+					if (thiz.m_position == thiz.m_data.size()) {
+						if (!thiz.m_name_stack.empty()) {
+							throw SyntaxException{thiz.m_position.value, mss("unclosed element"_sf())};
+						}
+						if (!thiz.m_root_found) {
+							throw SyntaxException{thiz.m_position.value, mss("no root element"_sf())};
+						}
+						return EventType::Constant::document_end();
+					}
+					if (thiz.m_data[thiz.m_position] != '<'_c) {
+						if (thiz.m_name_stack.empty()) {
+							throw SyntaxException{thiz.m_position.value, mss("text outside of root element"_sf())};
+						}
+						auto text_end = thiz.find_string("<"_sv);
+						thiz.m_buffer.set_size(k_none_size);
+						thiz.reserve_buffer(text_end - text_begin);
+						thiz.m_value = thiz.decode_string(thiz.m_data.sub(text_begin, text_end - text_begin), k_true);
+						thiz.m_cdata = k_false;
+						thiz.m_position = text_end;
+						return EventType::Constant::text();
+					}
+					if (thiz.test_string("<?"_sv)) {
+						thiz.m_position = thiz.find_string("?>"_sv) + 2_sz;
+						continue;
+					}
+					if (thiz.test_string("<!--"_sv)) {
+						auto value_begin = thiz.m_position + 4_sz;
+						thiz.m_position = value_begin;
+						auto value_end = thiz.find_string("-->"_sv);
+						thiz.m_buffer.set_size(k_none_size);
+						thiz.reserve_buffer(value_end - value_begin);
+						thiz.m_value = thiz.decode_string(thiz.m_data.sub(value_begin, value_end - value_begin), k_false);
+						thiz.m_position = value_end + 3_sz;
+						return EventType::Constant::comment();
 					}
-					node_value.attribute.allocate(attribute_count);
-					for (auto raw_attribute = raw_element->FirstAttribute(); raw_attribute; raw_attribute = raw_attribute->Next()) {
-						node_value.attribute.append(make_string(raw_attribute->Name()), make_string(raw_attribute->Value()));
+					if (thiz.test_string("<![CDATA["_sv)) {
+						if (thiz.m_name_stack.empty()) {
+							throw SyntaxException{thiz.m_position.value, mss("cdata outside of root element"_sf())};
+						}
+						auto value_begin = thiz.m_position + 9_sz;
+						thiz.m_position = value_begin;
+						auto value_end = thiz.find_string("]]>"_sv);
+						thiz.m_buffer.set_size(k_none_size);
+						thiz.reserve_buffer(value_end - value_begin);
+						thiz.m_value = thiz.decode_string(thiz.m_data.sub(value_begin, value_end - value_begin), k_false);
+						thiz.m_cdata = k_true;
+						thiz.m_position = value_end + 3_sz;
+						return EventType::Constant::text();
 					}
+					if (thiz.test_string("<!"_sv)) {
+						thiz.m_position = thiz.find_string(">"_sv) + 1_sz;
+						continue;
+					}
+					if (thiz.test_string("</"_sv)) {
+						thiz.m_position += 2_sz;
+						auto name = thiz.read_name();
+						thiz.skip_space();
+						thiz.read_mark('>'_c);
+						if (thiz.m_name_stack.empty() || thiz.m_name_stack.last() != name) {
+							throw SyntaxException{thiz.m_position.value, mss("mismatched element end"_sf())};
+						}
+						thiz.m_name = name;
+						thiz.m_name_stack.remove_tail();
+						return EventType::Constant::element_end();
+					}
+					thiz.m_position += 1_sz;
+					if (thiz.m_name_stack.empty() && thiz.m_root_found) {
+						throw SyntaxException{thiz.m_position.value, mss("more than one root element"_sf())};
+					}
+					thiz.read_element_begin();
+					return EventType::Constant::element_begin();
 				}
-				{
-					auto child_count = k_none_size;
-					for (auto raw_child = raw_element->FirstChild(); raw_child; raw_child = raw_child->NextSibling()) {
-						++child_count;
+			}
+
+			#pragma endregion
+
+			#pragma region value
+
+			// NOTE : element name, for element_begin and element_end
+			auto name (
+			) const -> CStringView const & {
+				return thiz.m_name;
+			}
+
+			// NOTE : for element_begin
+			auto attribute (
+			) const -> Map<CStringView, CStringView> const & {
+				return thiz.m_attribute;
+			}
+
+			// NOTE : for text and comment
+			auto value (
+			) const -> CStringView const & {
+				return thiz.m_value;
+			}
+
+			// NOTE : for text
+			auto cdata (
+			) const -> Boolean const & {
+				return thiz.m_cdata;
+			}
+
+			// NOTE : count of element that are opened and not yet closed
+			auto depth (
+			) const -> Size {
+				return thiz.m_name_stack.size();
+			}
+
+			#pragma endregion
+
+		protected:
+
+			#pragma region implement
+
+			static auto is_space (
+				Character const & character
+			) -> Boolean {
+				return character == ' '_c || character == '\t'_c || character == '\n'_c || character == '\r'_c;
+			}
+
+			static auto is_name_character (
+				Character const & character
+			) -> Boolean {
+				return CharacterType::is_alpha(character) || CharacterType::is_number_dec(character) || character == '_'_c || character == ':'_c || character == '.'_c || character == '-'_c || cbw<Character8>(character) >= 0x80_c8;
+			}
+
+			// ----------------
+
+			auto skip_space (
+			) -> Void {
+				while (thiz.m_position < thiz.m_data.size() && is_space(thiz.m_data[thiz.m_position])) {
+					++thiz.m_position;
+				}
+				return;
+			}
+
+			auto test_string (
+				CStringView const & string
+			) const -> Boolean {
+				return thiz.m_data.size() - thiz.m_position >= string.size() && thiz.m_data.sub(thiz.m_position, string.size()) == string;
+			}
+
+			// NOTE : position of the first occurrence of string since the current position, the current position is not changed
+			auto find_string (
+				CStringView const & string
+			) const -> Size {
+				auto position = thiz.m_position;
+				while (thiz.m_data.size() - position >= string.size()) {
+					if (thiz.m_data[position] == string.first() && thiz.m_data.sub(position, string.size()) == string) {
+						return position;
+					}
+					++position;
+				}
+				throw SyntaxException{thiz.m_position.value, mss("can not find \"{}\""_sf(string))};
+			}
+
+			auto read_mark (
+				Character const & mark
+			) -> Void {
+				if (thiz.m_position == thiz.m_data.size() || thiz.m_data[thiz.m_position] != mark) {
+					throw SyntaxException{thiz.m_position.value, mss("need \'{}\'"_sf(mark))};
+				}
+				++thiz.m_position;
+				return;
+			}
+
+			auto read_name (
+			) -> CStringView {
+				auto name_begin = thiz.m_position;
+				while (thiz.m_position < thiz.m_data.size() && is_name_character(thiz.m_data[thiz.m_position])) {
+					++thiz.m_position;
+				}
+				if (thiz.m_position == name_begin) {
+					throw SyntaxException{thiz.m_position.value, mss("invalid name"_sf())};
+				}
+				return thiz.m_data.sub(name_begin, thiz.m_position - name_begin);
+			}
+
+			auto read_element_begin (
+			) -> Void {
+				thiz.m_name = thiz.read_name();
+				thiz.m_attribute.set_size(k_none_size);
+				auto value_size = k_none_size;
+				while (k_true) {
+					thiz.skip_space();
+					if (thiz.test_string("/>"_sv)) {
+						thiz.m_position += 2_sz;
+						thiz.m_element_end_pending = k_true;
+						break;
+					}
+					if (thiz.test_string(">"_sv)) {
+						thiz.m_position += 1_sz;
+						break;
 					}
-					node_value.child.allocate(child_count);
-					for (auto raw_child = raw_element->FirstChild(); raw_child; raw_child = raw_child->NextSibling()) {
-						node_value.child.append();
-						convert_node(raw_child, node_value.child.last());
+					auto name = thiz.read_name();
+					thiz.skip_space();
+					thiz.read_mark('='_c);
+					thiz.skip_space();
+					if (thiz.m_position == thiz.m_data.size() || (thiz.m_data[thiz.m_position] != '"'_c && thiz.m_data[thiz.m_position] != '\''_c)) {
+						throw SyntaxException{thiz.m_position.value, mss("need quote of attribute value"_sf())};
 					}
+					auto quote = CStringView{thiz.m_data.sub(thiz.m_position, 1_sz)};
+					thiz.m_position += 1_sz;
+					auto value_end = thiz.find_string(quote);
+					if (thiz.m_attribute.has_key(name)) {
+						throw SyntaxException{thiz.m_position.value, mss("duplicate attribute"_sf())};
+					}
+					thiz.m_attribute.append(name, thiz.m_data.sub(thiz.m_position, value_end - thiz.m_position));
+					value_size += value_end - thiz.m_position;
+					thiz.m_position = value_end + 1_sz;
+				}
+				// NOTE : decoded value is never longer than the raw value, so the buffer will not be reallocated while decoding
+				thiz.m_buffer.set_size(k_none_size);
+				thiz.reserve_buffer(value_size);
+				for (auto & attribute : thiz.m_attribute) {
+					attribute.value = thiz.decode_string(attribute.value, k_true);
 				}
+				thiz.m_name_stack.append(thiz.m_name);
+				thiz.m_root_found = k_true;
+				return;
 			}
-			else if (auto raw_text = raw_node->ToText()) {
-				node.set_text();
-				auto & node_value = node.get_text();
-				node_value.value = make_string_view(raw_text->Value());
-				node_value.cdata = mbw<Boolean>(raw_text->CData());
+
+			// ----------------
+
+			auto reserve_buffer (
+				Size const & size
+			) -> Void {
+				if (thiz.m_buffer.capacity() < size) {
+					thiz.m_buffer.allocate(size);
+				}
+				return;
 			}
-			else if (auto raw_comment = raw_node->ToComment()) {
-				node.set_comment();
-				auto & node_value = node.get_comment();
-				node_value.value = make_string_view(raw_comment->Value());
+
+			// NOTE : unicode character reference, return the size of reference, or none if it is invalid
+			static auto parse_character_reference (
+				CStringView const & string,
+				Unicode &           character
+			) -> Size {
+				auto position = 2_sz;
+				auto is_hex = k_false;
+				if (position < string.size() && string[position] == 'x'_c) {
+					is_hex = k_true;
+					++position;
+				}
+				auto digit_begin = position;
+				character = 0x0_u;
+				while (position < string.size() && (is_hex ? (CharacterType::is_number_hex(string[position])) : (CharacterType::is_number_dec(string[position])))) {
+					character = character * (is_hex ? (0x10_u) : (10_u)) + cbw<Unicode>(CharacterType::from_number_hex(string[position]));
+					if (character >= 0x110000_u) {
+						return k_none_size;
+					}
+					++position;
+				}
+				if (position == digit_begin || position == string.size() || string[position] != ';'_c) {
+					return k_none_size;
+				}
+				return position + 1_sz;
 			}
-			else {
-				assert_fail(R"(/* node is valid */)");
+
+			// NOTE : the buffer must be reserved before, if the string need no decoding, it is returned as-is
+			auto decode_string (
+				CStringView const & string,
+				Boolean const &     process_entity
+			) -> CStringView {
+				auto need_decode = Range::find_index(string, '\r'_c).has() || (process_entity && Range::find_index(string, '&'_c).has());
+				if (!need_decode) {
+					return string;
+				}
+				auto result_begin = thiz.m_buffer.size();
+				auto position = k_begin_index;
+				while (position < string.size()) {
+					auto character = string[position];
+					if (character == '\r'_c || character == '\n'_c) {
+						thiz.m_buffer.append('\n'_c);
+						++position;
+						if (position < string.size() && string[position] == (character == '\r'_c ? ('\n'_c) : ('\r'_c))) {
+							++position;
+						}
+						continue;
+					}
+					if (process_entity && character == '&'_c) {
+						auto rest = CStringView{string.tail(string.size() - position)};
+						if (rest.size() > 1_sz && rest[2_ix] == '#'_c) {
+							auto unicode = Unicode{};
+							auto reference_size = parse_character_reference(rest, unicode);
+							if (reference_size != k_none_size) {
+								// NOTE : a reference is never shorter than the utf-8 encoding of it, so the buffer has enough capacity
+								auto unicode_position = thiz.m_buffer.size();
+								thiz.m_buffer.expand_size(4_sz);
+								auto unicode_stream = OCharacterStreamView{thiz.m_buffer.tail(4_sz)};
+								StringParser::write_utf8_character(unicode_stream, unicode);
+								thiz.m_buffer.set_size(unicode_position + unicode_stream.position());
+								position += reference_size;
+								continue;
+							}
+						}
+						else {
+							auto entity_size = k_none_size;
+							auto entity_value = Character{};
+							for (auto & [entity_pattern, entity_character] : {
+								std::pair{"&quot;"_sv, '"'_c},
+								std::pair{"&amp;"_sv, '&'_c},
+								std::pair{"&apos;"_sv, '\''_c},
+								std::pair{"&lt;"_sv, '<'_c},
+								std::pair{"&gt;"_sv, '>'_c},
+							}) {
+								if (rest.size() >= entity_pattern.size() && rest.head(entity_pattern.size()) == entity_pattern) {
+									entity_size = entity_pattern.size();
+									entity_value = entity_character;
+									break;
+								}
+							}
+							if (entity_size != k_none_size) {
+								thiz.m_buffer.append(entity_value);
+								position += entity_size;
+								continue;
+							}
+						}
+					}
+					thiz.m_buffer.append(character);
+					++position;
+				}
+				return thiz.m_buffer.sub(result_begin, thiz.m_buffer.size() - result_begin);
+			}
+
+			#pragma endregion
+
+		};
+
+		// ----------------
+
+		static auto process_element (
+			Reader & reader,
+			Node &   node
+		) -> Void {
+			auto & node_value = node.set_element();
+			node_value.name = reader.name();
+			node_value.attribute.allocate(reader.attribute().size());
+			for (auto & attribute : reader.attribute()) {
+				node_value.attribute.append(String{attribute.key}, String{attribute.value});
+			}
+			while (k_true) {
+				auto event = reader.next();
+				switch (event.value) {
+					case EventType::Constant::element_begin().value : {
+						process_element(reader, node_value.child.append());
+						break;
+					}
+					case EventType::Constant::element_end().value : {
+						return;
+					}
+					case EventType::Constant::text().value : {
+						auto & child_value = node_value.child.append().set_text();
+						child_value.value = reader.value();
+						child_value.cdata = reader.cdata();
+						break;
+					}
+					case EventType::Constant::comment().value : {
+						auto & child_value = node_value.child.append().set_comment();
+						child_value.value = reader.value();
+						break;
+					}
+					default : {
+						assert_fail(R"(/* event is valid */)");
+					}
+				}
 			}
 			return;
 		}
@@ -68,20 +483,21 @@ namespace TwinStar::Kernel::Tool::Data::Serialization::XML {
 			String const & data,
 			Node &         value
 		) -> Void {
-			auto raw_document = Third::tinyxml2::XMLDocument{};
-			raw_document.Parse(cast_pointer<ZCharacter>(data.begin()).value, data.size().value);
-			auto current_child = raw_document.FirstChild();
-			assert_test(current_child != nullptr);
-			auto declaration = current_child->ToDeclaration();
-			if (declaration) {
-				current_child = current_child->NextSibling();
-			}
-			assert_test(current_child != nullptr);
-			auto root_element = current_child->ToElement();
-			assert_test(root_element);
-			current_child = current_child->NextSibling();
-			assert_test(current_child == nullptr);
-			convert_node(root_element, value);
+			auto reader = Reader{data};
+			for (auto event = reader.next(); event != EventType::Constant::document_end(); event = reader.next()) {
+				switch (event.value) {
+					case EventType::Constant::element_begin().value : {
+						process_element(reader, value);
+						break;
+					}
+					case EventType::Constant::comment().value : {
+						break;
+					}
+					default : {
+						assert_fail(R"(/* event is valid */)");
+					}
+				}
+			}
 			return;
 		}
 
@@ -1,10 +1,7 @@
 #pragma once
 
-// TODO : refactor, use stream style api ?
-
 #include "kernel/utility/utility.hpp"
 #include "kernel/tool/data/serialization/xml/common.hpp"
-#include "kernel/third/tinyxml2.hpp"
 
 namespace TwinStar::Kernel::Tool::Data::Serialization::XML {
 
@@ -15,38 +12,282 @@ namespace TwinStar::Kernel::Tool::Data::Serialization::XML {
 
 		// ----------------
 
-		static auto convert_node (
-			Third::tinyxml2::XMLDocument & raw_document,
-			Node const &                   node
-		) -> ZPointer<Third::tinyxml2::XMLNode> {
-			auto raw_node = ZPointer<Third::tinyxml2::XMLNode>{};
+		// NOTE
+		// streaming writer, every event is printed into the output string at once, no document tree is built
+		// the output is the same as the tinyxml2 printer : indent by tab, text keep its parent element on one line, no declaration
+		class Writer {
+
+		protected:
+
+			String & m_data;
+
+			String m_name_stack;
+
+			List<Size> m_name_stack_position;
+
+			Size m_depth;
+
+			Optional<Size> m_text_depth;
+
+			Boolean m_element_just_opened;
+
+			Boolean m_first_element;
+
+		public:
+
+			#pragma region structor
+
+			~Writer (
+			) = default;
+
+			// ----------------
+
+			Writer (
+			) = delete;
+
+			Writer (
+				Writer const & that
+			) = delete;
+
+			Writer (
+				Writer && that
+			) = delete;
+
+			// ----------------
+
+			explicit Writer (
+				String & data
+			) :
+				m_data{data},
+				m_name_stack{},
+				m_name_stack_position{},
+				m_depth{k_none_size},
+				m_text_depth{},
+				m_element_just_opened{k_false},
+				m_first_element{k_true} {
+			}
+
+			#pragma endregion
+
+			#pragma region operator
+
+			auto operator = (
+				Writer const & that
+			) -> Writer & = delete;
+
+			auto operator = (
+				Writer && that
+			) -> Writer & = delete;
+
+			#pragma endregion
+
+			#pragma region event
+
+			auto open_element (
+				CStringView const & name
+			) -> Void {
+				thiz.prepare_for_new_node();
+				thiz.m_name_stack_position.append(thiz.m_name_stack.size());
+				thiz.m_name_stack.append_list(name);
+				thiz.m_data.append('<'_c);
+				thiz.m_data.append_list(name);
+				thiz.m_element_just_opened = k_true;
+				++thiz.m_depth;
+				return;
+			}
+
+			auto push_attribute (
+				CStringView const & name,
+				CStringView const & value
+			) -> Void {
+				assert_test(thiz.m_element_just_opened);
+				thiz.m_data.append(' '_c);
+				thiz.m_data.append_list(name);
+				thiz.m_data.append('='_c);
+				thiz.m_data.append('"'_c);
+				thiz.write_escape_string(value, k_false);
+				thiz.m_data.append('"'_c);
+				return;
+			}
+
+			auto close_element (
+			) -> Void {
+				assert_test(!thiz.m_name_stack_position.empty());
+				--thiz.m_depth;
+				auto name_position = thiz.m_name_stack_position.last();
+				if (thiz.m_element_just_opened) {
+					thiz.m_data.append('/'_c);
+					thiz.m_data.append('>'_c);
+				}
+				else {
+					if (!thiz.m_text_depth.has()) {
+						thiz.m_data.append('\n'_c);
+						thiz.write_indent();
+					}
+					thiz.m_data.append('<'_c);
+					thiz.m_data.append('/'_c);
+					thiz.m_data.append_list(thiz.m_name_stack.tail(thiz.m_name_stack.size() - name_position));
+					thiz.m_data.append('>'_c);
+				}
+				thiz.m_name_stack.set_size(name_position);
+				thiz.m_name_stack_position.remove_tail();
+				if (thiz.m_text_depth.has() && thiz.m_text_depth.get() == thiz.m_depth) {
+					thiz.m_text_depth.reset();
+				}
+				if (thiz.m_depth == k_none_size) {
+					thiz.m_data.append('\n'_c);
+				}
+				thiz.m_element_just_opened = k_false;
+				return;
+			}
+
+			auto push_text (
+				CStringView const & value,
+				Boolean const &     cdata
+			) -> Void {
+				assert_test(thiz.m_depth > k_none_size);
+				thiz.m_text_depth.set(thiz.m_depth - 1_sz);
+				thiz.seal_element_if_just_opened();
+				if (cdata) {
+					thiz.m_data.append_list("<![CDATA["_sv);
+					thiz.m_data.append_list(value);
+					thiz.m_data.append_list("]]>"_sv);
+				}
+				else {
+					thiz.write_escape_string(value, k_true);
+				}
+				return;
+			}
+
+			auto push_comment (
+				CStringView const & value
+			) -> Void {
+				thiz.prepare_for_new_node();
+				thiz.m_data.append_list("<!--"_sv);
+				thiz.m_data.append_list(value);
+				thiz.m_data.append_list("-->"_sv);
+				return;
+			}
+
+			#pragma endregion
+
+		protected:
+
+			#pragma region implement
+
+			auto write_indent (
+			) -> Void {
+				for (auto & index : SizeRange{thiz.m_depth}) {
+					thiz.m_data.append('\t'_c);
+				}
+				return;
+			}
+
+			auto seal_element_if_just_opened (
+			) -> Void {
+				if (thiz.m_element_just_opened) {
+					thiz.m_element_just_opened = k_false;
+					thiz.m_data.append('>'_c);
+				}
+				return;
+			}
+
+			auto prepare_for_new_node (
+			) -> Void {
+				thiz.seal_element_if_just_opened();
+				if (thiz.m_first_element) {
+					thiz.write_indent();
+				}
+				else if (!thiz.m_text_depth.has()) {
+					thiz.m_data.append('\n'_c);
+					thiz.write_indent();
+				}
+				thiz.m_first_element = k_false;
+				return;
+			}
+
+			// NOTE : text escape only '&' '<' '>', attribute value escape the quote too
+			auto write_escape_string (
+				CStringView const & value,
+				Boolean const &     restricted
+			) -> Void {
+				auto run_begin = k_begin_index;
+				for (auto & index : SizeRange{value.size()}) {
+					auto entity = CStringView{};
+					switch (value[index].value) {
+						case '&' : {
+							entity = "&amp;"_sv;
+							break;
+						}
+						case '<' : {
+							entity = "&lt;"_sv;
+							break;
+						}
+						case '>' : {
+							entity = "&gt;"_sv;
+							break;
+						}
+						case '"' : {
+							if (!restricted) {
+								entity = "&quot;"_sv;
+							}
+							break;
+						}
+						case '\'' : {
+							if (!restricted) {
+								entity = "&apos;"_sv;
+							}
+							break;
+						}
+						default : {
+							break;
+						}
+					}
+					if (!entity.empty()) {
+						thiz.m_data.append_list(value.sub(run_begin, index - run_begin));
+						thiz.m_data.append_list(entity);
+						run_begin = index + 1_sz;
+					}
+				}
+				thiz.m_data.append_list(value.tail(value.size() - run_begin));
+				return;
+			}
+
+			#pragma endregion
+
+		};
+
+		// ----------------
+
+		static auto process_node (
+			Writer &     writer,
+			Node const & node
+		) -> Void {
 			switch (node.type().value) {
 				case NodeType::Constant::element().value : {
 					auto & node_value = node.get_element();
-					raw_node = raw_document.NewElement(cast_pointer<char>(make_null_terminated_string(node_value.name).begin()).value);
-					auto raw_element = raw_node->ToElement();
+					writer.open_element(node_value.name);
 					for (auto & attribute : node_value.attribute) {
-						raw_element->SetAttribute(cast_pointer<char>(make_null_terminated_string(attribute.key).begin()).value, cast_pointer<char>(make_null_terminated_string(attribute.value).begin()).value);
+						writer.push_attribute(attribute.key, attribute.value);
 					}
 					for (auto & child : node_value.child) {
-						raw_element->InsertEndChild(convert_node(raw_document, child));
+						process_node(writer, child);
 					}
+					writer.close_element();
 					break;
 				}
 				case NodeType::Constant::text().value : {
 					auto & node_value = node.get_text();
-					raw_node = raw_document.NewText(cast_pointer<char>(make_null_terminated_string(node_value.value).begin()).value);
-					auto raw_text = raw_node->ToText();
-					raw_text->SetCData(node_value.cdata.value);
+					writer.push_text(node_value.value, node_value.cdata);
 					break;
 				}
 				case NodeType::Constant::comment().value : {
 					auto & node_value = node.get_comment();
-					raw_node = raw_document.NewComment(cast_pointer<char>(make_null_terminated_string(node_value.value).begin()).value);
+					writer.push_comment(node_value.value);
 					break;
 				}
 			}
-			return raw_node;
+			return;
 		}
 
 		// ----------------
@@ -55,11 +296,8 @@ namespace TwinStar::Kernel::Tool::Data::Serialization::XML {
 			String &     data,
 			Node const & value
 		) -> Void {
-			auto raw_document = Third::tinyxml2::XMLDocument{};
-			raw_document.InsertEndChild(convert_node(raw_document, value));
-			auto printer = TinyXML2Printer{};
-			raw_document.Print(&printer);
-			data = move_printer_buffer_if_can(printer);
+			auto writer = Writer{data};
+			process_node(writer, value);
 			return;
 		}
 
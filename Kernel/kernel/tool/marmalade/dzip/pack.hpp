@@ -5,6 +5,7 @@
 #include "kernel/tool/data/compression/deflate/compress.hpp"
 #include "kernel/tool/data/compression/bzip2/compress.hpp"
 #include "kernel/tool/data/compression/lzma/compress.hpp"
+#include <unordered_map>
 
 namespace TwinStar::Kernel::Tool::Marmalade::DZip {
 
@@ -42,15 +43,15 @@ namespace TwinStar::Kernel::Tool::Marmalade::DZip {
 				information_structure.chunk_information.allocate_full(k_none_size);
 				information_structure.archive_resource_information.allocate_full(k_none_size);
 				information_structure.resource_directory.append(""_sv);
+				auto resource_directory_map = std::unordered_map<String, Size>{};
+				resource_directory_map.emplace(information_structure.resource_directory.last(), information_structure.resource_directory.last_index());
 				auto global_chunk_index = k_begin_index;
 				for (auto & resource_index : SizeRange{definition.resource.size()}) {
 					auto & resource_definition = definition.resource[resource_index];
 					auto & resource_information_structure = information_structure.resource_information[resource_index];
 					auto   resource_directory_string = resource_definition.path.parent().to_string(CharacterType::PathSeparator::windows);
 					information_structure.resource_file.append(resource_definition.path.name());
-					if (auto index = Range::find_index(information_structure.resource_directory, resource_directory_string); index.has()) {
-					}
-					else {
+					if (resource_directory_map.try_emplace(resource_directory_string, information_structure.resource_directory.size()).second) {
 						information_structure.resource_directory.append(resource_directory_string);
 					}
 					resource_information_structure.chunk_index.allocate_full(cbw<Size>(resource_definition.chunk.size()));
@@ -107,6 +108,16 @@ namespace TwinStar::Kernel::Tool::Marmalade::DZip {
 			information_structure.chunk_information.allocate_full(k_none_size);
 			information_structure.archive_resource_information.allocate_full(k_none_size);
 			information_structure.resource_directory.append(""_sv);
+			auto resource_directory_map = std::unordered_map<String, Size>{};
+			resource_directory_map.emplace(information_structure.resource_directory.last(), information_structure.resource_directory.last_index());
+			struct ChunkTask {
+				Path                                          resource_path;
+				BitSet<Structure::ChunkFlag<version>::k_count> flag;
+				ByteArray                                     data;
+				Size                                          size_uncompressed;
+				Size                                          size_compressed;
+			};
+			auto chunk_task_list = List<ChunkTask>{};
 			auto global_chunk_index = k_begin_index;
 			for (auto & resource_index : SizeRange{definition.resource.size()}) {
 				auto & resource_definition = definition.resource[resource_index];
@@ -114,18 +125,17 @@ namespace TwinStar::Kernel::Tool::Marmalade::DZip {
 				auto   resource_path = resource_directory / resource_definition.path;
 				auto   resource_directory_string = resource_definition.path.parent().to_string(CharacterType::PathSeparator::windows);
 				information_structure.resource_file.append(resource_definition.path.name());
-				if (auto index = Range::find_index(information_structure.resource_directory, resource_directory_string); index.has()) {
-					resource_information_structure.directory_index = cbw<IntegerU16>(index.get());
-				}
-				else {
+				if (auto [iterator, inserted] = resource_directory_map.try_emplace(resource_directory_string, information_structure.resource_directory.size()); inserted) {
 					information_structure.resource_directory.append(resource_directory_string);
 					resource_information_structure.directory_index = cbw<IntegerU16>(information_structure.resource_directory.last_index());
 				}
+				else {
+					resource_information_structure.directory_index = cbw<IntegerU16>(iterator->second);
+				}
 				resource_information_structure.chunk_index.allocate_full(cbw<Size>(resource_definition.chunk.size()));
 				for (auto & chunk_index : SizeRange{resource_definition.chunk.size()}) {
 					resource_information_structure.chunk_index[chunk_index] = cbw<IntegerU16>(global_chunk_index);
 					auto & chunk_definition = resource_definition.chunk[chunk_index];
-					auto & chunk_information_structure = information_structure.chunk_information.append();
 					auto   chunk_flag = BitSet<Structure::ChunkFlag<version>::k_count>{};
 					switch (chunk_definition.flag.hash().value) {
 						case "zlib"_shz : {
@@ -148,9 +158,6 @@ namespace TwinStar::Kernel::Tool::Marmalade::DZip {
 							assert_fail(R"(chunk.flag == /* valid */)");
 						}
 					}
-					auto chunk_size_uncompressed = Size{};
-					auto chunk_size_compressed = Size{};
-					chunk_information_structure.offset = cbw<IntegerU32>(data.position());
 					if (chunk_flag.get(Structure::ChunkFlag<version>::combuf)) {
 						throw IncompleteException{};
 					}
@@ -160,19 +167,6 @@ namespace TwinStar::Kernel::Tool::Marmalade::DZip {
 					if (chunk_flag.get(Structure::ChunkFlag<version>::dzip)) {
 						throw IncompleteException{};
 					}
-					if (chunk_flag.get(Structure::ChunkFlag<version>::zlib)) {
-						auto chunk_data = FileSystem::read_file(resource_path);
-						Data::Compression::Deflate::Compress::process(as_lvalue(IByteStreamView{chunk_data}), data, 9_sz, 15_sz, 9_sz, Data::Compression::Deflate::Strategy::Constant::default_mode(), Data::Compression::Deflate::Wrapper::Constant::gzip());
-						data.backward(8_sz); // NOTE : overwrite gzip trail
-						chunk_size_uncompressed = chunk_data.size();
-						chunk_size_compressed = chunk_size_uncompressed;
-					}
-					if (chunk_flag.get(Structure::ChunkFlag<version>::bzip2)) {
-						auto chunk_data = FileSystem::read_file(resource_path);
-						Data::Compression::BZip2::Compress::process(as_lvalue(IByteStreamView{chunk_data}), data, 9_sz, 0_sz);
-						chunk_size_uncompressed = chunk_data.size();
-						chunk_size_compressed = chunk_size_uncompressed;
-					}
 					if (chunk_flag.get(Structure::ChunkFlag<version>::mp3)) {
 						throw IncompleteException{};
 					}
@@ -185,24 +179,77 @@ namespace TwinStar::Kernel::Tool::Marmalade::DZip {
 						// chunk_size_uncompressed = ;
 						// chunk_size_compressed = k_none_size;
 					}
-					if (chunk_flag.get(Structure::ChunkFlag<version>::copy_coded)) {
-						chunk_size_uncompressed = FileSystem::read_stream_file(resource_path, data);
-						chunk_size_compressed = chunk_size_uncompressed;
+					if (chunk_flag.get(Structure::ChunkFlag<version>::random_access)) {
+						throw IncompleteException{};
 					}
-					if (chunk_flag.get(Structure::ChunkFlag<version>::lzma)) {
-						auto chunk_data = FileSystem::read_file(resource_path);
-						Data::Compression::Lzma::Compress::process(as_lvalue(IByteStreamView{chunk_data}), data, 9_sz);
-						chunk_size_uncompressed = chunk_data.size();
+					information_structure.chunk_information.append();
+					chunk_task_list.append(ChunkTask{.resource_path = resource_path, .flag = chunk_flag, .data = {}, .size_uncompressed = k_none_size, .size_compressed = k_none_size});
+					++global_chunk_index;
+				}
+			}
+			// NOTE : chunks are read and compressed concurrently in batch, then written in definition order, the batch bound the memory held by compressed chunk
+			auto compress_chunk =
+				[] (
+				ChunkTask & task
+			) -> Void {
+				if (task.flag.get(Structure::ChunkFlag<version>::copy_coded)) {
+					return;
+				}
+				auto chunk_data = FileSystem::read_file(task.resource_path);
+				auto raw_stream = IByteStreamView{chunk_data};
+				auto ripe_size_bound = Size{};
+				if (task.flag.get(Structure::ChunkFlag<version>::zlib)) {
+					Data::Compression::Deflate::Compress::estimate(chunk_data.size(), ripe_size_bound, 15_sz, 9_sz, Data::Compression::Deflate::Wrapper::Constant::gzip());
+				}
+				else {
+					// NOTE : bzip2 and lzma expand incompressible data by a few percent at most
+					ripe_size_bound = chunk_data.size() + chunk_data.size() / 8_sz + 1024_sz;
+				}
+				task.data.allocate(ripe_size_bound);
+				auto ripe_stream = OByteStreamView{task.data};
+				if (task.flag.get(Structure::ChunkFlag<version>::zlib)) {
+					Data::Compression::Deflate::Compress::process(raw_stream, ripe_stream, 9_sz, 15_sz, 9_sz, Data::Compression::Deflate::Strategy::Constant::default_mode(), Data::Compression::Deflate::Wrapper::Constant::gzip());
+					ripe_stream.backward(8_sz); // NOTE : overwrite gzip trail
+				}
+				if (task.flag.get(Structure::ChunkFlag<version>::bzip2)) {
+					Data::Compression::BZip2::Compress::process(raw_stream, ripe_stream, 9_sz, 0_sz);
+				}
+				if (task.flag.get(Structure::ChunkFlag<version>::lzma)) {
+					Data::Compression::Lzma::Compress::process(raw_stream, ripe_stream, 9_sz);
+				}
+				task.size_uncompressed = chunk_data.size();
+				task.size_compressed = ripe_stream.position();
+				return;
+			};
+			auto batch_size = hardware_thread_count() * 2_sz;
+			for (auto batch_begin = k_begin_index; batch_begin < chunk_task_list.size(); batch_begin += batch_size) {
+				auto batch_end = minimum(batch_begin + batch_size, chunk_task_list.size());
+				parallel_each(
+					batch_end - batch_begin,
+					[&] (Size const & index) {
+						compress_chunk(chunk_task_list[batch_begin + index]);
+					}
+				);
+				for (auto & chunk_index : SizeRange{batch_begin, batch_end}) {
+					auto & task = chunk_task_list[chunk_index];
+					auto & chunk_information_structure = information_structure.chunk_information[chunk_index];
+					auto   chunk_size_uncompressed = Size{};
+					auto   chunk_size_compressed = Size{};
+					chunk_information_structure.offset = cbw<IntegerU32>(data.position());
+					if (task.flag.get(Structure::ChunkFlag<version>::copy_coded)) {
+						chunk_size_uncompressed = FileSystem::read_stream_file(task.resource_path, data);
 						chunk_size_compressed = chunk_size_uncompressed;
 					}
-					if (chunk_flag.get(Structure::ChunkFlag<version>::random_access)) {
-						throw IncompleteException{};
+					else {
+						data.write(task.data.head(task.size_compressed));
+						chunk_size_uncompressed = task.size_uncompressed;
+						chunk_size_compressed = chunk_size_uncompressed;
+						task.data.reset();
 					}
 					chunk_information_structure.size_compressed = cbw<IntegerU32>(chunk_size_compressed);
 					chunk_information_structure.size_uncompressed = cbw<IntegerU32>(chunk_size_uncompressed);
-					chunk_information_structure.flag = chunk_flag.to_integer();
+					chunk_information_structure.flag = task.flag.to_integer();
 					chunk_information_structure.file = 0_iu16;
-					++global_chunk_index;
 				}
 			}
 			information_structure.chunk_setting.archive_resource_count = 1_iu16;
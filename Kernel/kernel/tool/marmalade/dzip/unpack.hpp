@@ -5,6 +5,7 @@
 #include "kernel/tool/data/compression/deflate/uncompress.hpp"
 #include "kernel/tool/data/compression/bzip2/uncompress.hpp"
 #include "kernel/tool/data/compression/lzma/uncompress.hpp"
+#include <unordered_map>
 
 namespace TwinStar::Kernel::Tool::Marmalade::DZip {
 
@@ -18,131 +19,346 @@ namespace TwinStar::Kernel::Tool::Marmalade::DZip {
 
 		// ----------------
 
-		static auto process_package (
-			IByteStreamView &              data,
-			typename Definition::Package & definition,
-			Optional<Path> const &         resource_directory
+		inline static constexpr auto k_information_read_size = Size{0x10000_sz};
+
+		// ----------------
+
+		static auto process_information (
+			IByteStreamView &                 data,
+			Structure::Information<version> & information_structure
 		) -> Void {
 			data.read_constant(Structure::k_magic_identifier);
-			auto information_structure = Structure::Information<version>{};
+			data.read(information_structure.archive_setting);
+			information_structure.resource_file.allocate_full(cbw<Size>(information_structure.archive_setting.resource_file_count));
+			assert_test(information_structure.archive_setting.version == cbw<Structure::VersionNumber>(version.number));
+			for (auto & element : information_structure.resource_file) {
+				auto string = CStringView{};
+				StringParser::read_string_until(self_cast<ICharacterStreamView>(data), string, CharacterType::k_null);
+				self_cast<ICharacterStreamView>(data).read_constant(CharacterType::k_null);
+				element = string;
+			}
+			information_structure.resource_directory.allocate_full(cbw<Size>(information_structure.archive_setting.resource_directory_count));
+			information_structure.resource_directory[1_ix] = ""_sv;
+			for (auto & element : information_structure.resource_directory.tail(information_structure.resource_directory.size() - 1_sz)) {
+				auto string = CStringView{};
+				StringParser::read_string_until(self_cast<ICharacterStreamView>(data), string, CharacterType::k_null);
+				self_cast<ICharacterStreamView>(data).read_constant(CharacterType::k_null);
+				element = string;
+			}
+			data.read(information_structure.resource_information, cbw<Size>(information_structure.archive_setting.resource_file_count));
+			data.read(information_structure.chunk_setting);
+			data.read(information_structure.chunk_information, cbw<Size>(information_structure.chunk_setting.chunk_count));
+			data.read(information_structure.archive_resource_information, cbw<Size>(information_structure.chunk_setting.archive_resource_count) - 1_sz);
+			return;
+		}
+
+		// NOTE : head_data_of(size) provide the head part of the package that is at least size byte, return the size of the information section
+		// the size is computed from the counts as they are read, so no more than the information section is ever requested
+		template <typename HeadDataOf> requires
+			CategoryConstraint<IsPureInstance<HeadDataOf>>
+			&& (IsGenericCallable<HeadDataOf>)
+		static auto compute_information_size (
+			HeadDataOf const & head_data_of
+		) -> Size {
+			auto size = bs_static_size<Structure::MagicIdentifier>() + bs_static_size<Structure::ArchiveSetting<version>>();
+			auto archive_setting = Structure::ArchiveSetting<version>{};
 			{
-				data.read(information_structure.archive_setting);
-				information_structure.resource_file.allocate_full(cbw<Size>(information_structure.archive_setting.resource_file_count));
-				assert_test(information_structure.archive_setting.version == cbw<Structure::VersionNumber>(version.number));
-				for (auto & element : information_structure.resource_file) {
-					auto string = CStringView{};
-					StringParser::read_string_until(self_cast<ICharacterStreamView>(data), string, CharacterType::k_null);
-					self_cast<ICharacterStreamView>(data).read_constant(CharacterType::k_null);
-					element = string;
+				auto data = IByteStreamView{head_data_of(size)};
+				data.read_constant(Structure::k_magic_identifier);
+				data.read(archive_setting);
+			}
+			assert_test(archive_setting.version == cbw<Structure::VersionNumber>(version.number));
+			auto string_count = cbw<Size>(archive_setting.resource_file_count) + cbw<Size>(archive_setting.resource_directory_count) - 1_sz;
+			for (auto & index : SizeRange{string_count}) {
+				while (head_data_of(size + 1_sz)[size] != k_null_byte) {
+					++size;
 				}
-				information_structure.resource_directory.allocate_full(cbw<Size>(information_structure.archive_setting.resource_directory_count));
-				information_structure.resource_directory[1_ix] = ""_sv;
-				for (auto & element : information_structure.resource_directory.tail(information_structure.resource_directory.size() - 1_sz)) {
-					auto string = CStringView{};
-					StringParser::read_string_until(self_cast<ICharacterStreamView>(data), string, CharacterType::k_null);
-					self_cast<ICharacterStreamView>(data).read_constant(CharacterType::k_null);
-					element = string;
+				++size;
+			}
+			for (auto & index : SizeRange{cbw<Size>(archive_setting.resource_file_count)}) {
+				size += bs_static_size<IntegerU16>();
+				while (k_true) {
+					auto chunk_index_data = head_data_of(size + bs_static_size<IntegerU16>());
+					size += bs_static_size<IntegerU16>();
+					if (chunk_index_data[size - 2_sz] == 0xFF_b && chunk_index_data[size - 1_sz] == 0xFF_b) {
+						break;
+					}
 				}
-				data.read(information_structure.resource_information, cbw<Size>(information_structure.archive_setting.resource_file_count));
-				data.read(information_structure.chunk_setting);
-				data.read(information_structure.chunk_information, cbw<Size>(information_structure.chunk_setting.chunk_count));
-				data.read(information_structure.archive_resource_information, cbw<Size>(information_structure.chunk_setting.archive_resource_count) - 1_sz);
 			}
+			auto chunk_setting = Structure::ChunkSetting<version>{};
+			{
+				auto data = IByteStreamView{head_data_of(size + bs_static_size<Structure::ChunkSetting<version>>())};
+				data.set_position(size);
+				data.read(chunk_setting);
+				size = data.position();
+			}
+			size += cbw<Size>(chunk_setting.chunk_count) * bs_static_size<Structure::ChunkInformation<version>>();
+			size += (cbw<Size>(chunk_setting.archive_resource_count) - 1_sz) * bs_static_size<Structure::ArchiveResourceInformation<version>>();
+			return size;
+		}
+
+		// NOTE : ripe_data begin at the offset of the chunk, return the size of ripe data consumed
+		// read from an independent view, so different chunk can be processed concurrently
+		static auto process_chunk (
+			CByteListView const &                        ripe_data,
+			Structure::ChunkInformation<version> const & chunk_information_structure,
+			typename Definition::Chunk &                 chunk_definition,
+			ByteArray &                                  chunk_data
+		) -> Size {
+			auto data = IByteStreamView{ripe_data};
+			chunk_data.allocate(cbw<Size>(chunk_information_structure.size_uncompressed));
+			auto chunk_size_compressed = cbw<Size>(chunk_information_structure.size_compressed);
+			auto chunk_flag = BitSet<Structure::ChunkFlag<version>::k_count>{};
+			chunk_flag.from_integer(chunk_information_structure.flag);
+			assert_test(!chunk_flag.get(Structure::ChunkFlag<version>::unused_2));
+			auto chunk_ok = k_false;
+			if (chunk_flag.get(Structure::ChunkFlag<version>::combuf)) {
+				assert_test(!chunk_ok);
+				chunk_ok = k_true;
+				throw IncompleteException{};
+			}
+			if (chunk_flag.get(Structure::ChunkFlag<version>::dzip)) {
+				assert_test(!chunk_ok);
+				chunk_ok = k_true;
+				throw IncompleteException{};
+			}
+			if (chunk_flag.get(Structure::ChunkFlag<version>::zlib)) {
+				assert_test(!chunk_ok);
+				chunk_ok = k_true;
+				assert_test(chunk_size_compressed == chunk_data.size());
+				chunk_definition.flag = "zlib"_s;
+				auto chunk_stream = OByteStreamView{chunk_data};
+				data.forward(10_sz); // TODO NOTE : skip gzip header
+				Data::Compression::Deflate::Uncompress::process(data, chunk_stream, 15_sz, Data::Compression::Deflate::Wrapper::Constant::none());
+				assert_test(chunk_stream.full());
+			}
+			if (chunk_flag.get(Structure::ChunkFlag<version>::bzip2)) {
+				assert_test(!chunk_ok);
+				chunk_ok = k_true;
+				assert_test(chunk_size_compressed == chunk_data.size());
+				chunk_definition.flag = "bzip2"_s;
+				auto chunk_stream = OByteStreamView{chunk_data};
+				Data::Compression::BZip2::Uncompress::process(data, chunk_stream, k_false);
+				assert_test(chunk_stream.full());
+			}
+			if (chunk_flag.get(Structure::ChunkFlag<version>::mp3)) {
+				assert_test(!chunk_ok);
+				chunk_ok = k_true;
+				throw IncompleteException{};
+			}
+			if (chunk_flag.get(Structure::ChunkFlag<version>::jpeg)) {
+				assert_test(!chunk_ok);
+				chunk_ok = k_true;
+				throw IncompleteException{};
+			}
+			if (chunk_flag.get(Structure::ChunkFlag<version>::zerod_out)) {
+				assert_test(!chunk_ok);
+				chunk_ok = k_true;
+				assert_test(chunk_size_compressed == k_none_size);
+				chunk_definition.flag = "zerod_out"_s;
+				Range::assign(chunk_data, k_null_byte);
+			}
+			if (chunk_flag.get(Structure::ChunkFlag<version>::copy_coded)) {
+				assert_test(!chunk_ok);
+				chunk_ok = k_true;
+				assert_test(chunk_size_compressed == chunk_data.size());
+				chunk_definition.flag = "copy_coded"_s;
+				Range::assign_from(chunk_data, data.forward_view(chunk_data.size()));
+			}
+			if (chunk_flag.get(Structure::ChunkFlag<version>::lzma)) {
+				assert_test(!chunk_ok);
+				chunk_ok = k_true;
+				assert_test(chunk_size_compressed == chunk_data.size());
+				chunk_definition.flag = "lzma"_s;
+				auto chunk_stream = OByteStreamView{chunk_data};
+				Data::Compression::Lzma::Uncompress::process(data, chunk_stream);
+				assert_test(chunk_stream.full());
+			}
+			if (chunk_flag.get(Structure::ChunkFlag<version>::random_access)) {
+				assert_test(!chunk_ok);
+				chunk_ok = k_true;
+				throw IncompleteException{};
+			}
+			assert_test(chunk_ok);
+			return data.position();
+		}
+
+		// NOTE : ripe_data_of(chunk_index) provide the ripe data that begin at the offset of the chunk, return the end position of the consumed ripe data
+		template <typename RipeDataOf> requires
+			CategoryConstraint<IsPureInstance<RipeDataOf>>
+			&& (IsGenericCallable<RipeDataOf>)
+		static auto process_resource (
+			Structure::Information<version> const & information_structure,
+			Size const &                            resource_index,
+			typename Definition::Resource &         resource_definition,
+			Optional<Path> const &                  resource_directory,
+			RipeDataOf const &                      ripe_data_of
+		) -> Size {
+			auto & resource_information_structure = information_structure.resource_information[resource_index];
+			auto   data_end_position = k_none_size;
+			resource_definition.path = Path{information_structure.resource_directory[cbw<Size>(resource_information_structure.directory_index)]} / information_structure.resource_file[resource_index];
+			resource_definition.chunk.allocate_full(resource_information_structure.chunk_index.size());
+			auto chunk_data_list = Array<ByteArray>{resource_information_structure.chunk_index.size()};
+			for (auto & chunk_index : SizeRange{resource_information_structure.chunk_index.size()}) {
+				auto   global_chunk_index = cbw<Size>(resource_information_structure.chunk_index[chunk_index]);
+				auto & chunk_information_structure = information_structure.chunk_information[global_chunk_index];
+				auto   chunk_ripe_size = process_chunk(ripe_data_of(global_chunk_index), chunk_information_structure, resource_definition.chunk[chunk_index], chunk_data_list[chunk_index]);
+				data_end_position = maximum(data_end_position, cbw<Size>(chunk_information_structure.offset) + chunk_ripe_size);
+			}
+			assert_test(!chunk_data_list.empty() && Range::all_of(chunk_data_list.tail(chunk_data_list.size() - 1_sz), [&] (auto & element) { return element == chunk_data_list.first(); }));
+			if (resource_directory.has()) {
+				FileSystem::write_file(resource_directory.get() / resource_definition.path, chunk_data_list.first());
+			}
+			return data_end_position;
+		}
+
+		// ----------------
+
+		static auto process_package (
+			IByteStreamView &              data,
+			typename Definition::Package & definition,
+			Optional<Path> const &         resource_directory
+		) -> Void {
+			auto information_structure = Structure::Information<version>{};
+			process_information(data, information_structure);
 			definition.resource.allocate_full(information_structure.resource_information.size());
+			// NOTE : resources own disjoint chunks and output files, so they are decompressed concurrently
+			auto data_end_position_list = List<Size>{};
+			data_end_position_list.allocate_full(information_structure.resource_information.size());
+			parallel_each(
+				information_structure.resource_information.size(),
+				[&] (Size const & resource_index) {
+					data_end_position_list[resource_index] = process_resource(
+						information_structure,
+						resource_index,
+						definition.resource[resource_index],
+						resource_directory,
+						[&] (Size const & chunk_index) -> CByteListView {
+							return data.view().tail(data.size() - cbw<Size>(information_structure.chunk_information[chunk_index].offset));
+						}
+					);
+				}
+			);
 			auto package_data_end_position = data.position();
+			for (auto & data_end_position : data_end_position_list) {
+				package_data_end_position = maximum(package_data_end_position, data_end_position);
+			}
+			data.set_position(package_data_end_position);
+			return;
+		}
+
+		static auto find_resource_index (
+			Structure::Information<version> const & information_structure,
+			List<Path> const &                      resource
+		) -> List<Size> {
+			auto resource_index_map = std::unordered_map<String, Size>{};
 			for (auto & resource_index : SizeRange{information_structure.resource_information.size()}) {
 				auto & resource_information_structure = information_structure.resource_information[resource_index];
-				auto & resource_definition = definition.resource[resource_index];
-				resource_definition.path = Path{information_structure.resource_directory[cbw<Size>(resource_information_structure.directory_index)]} / information_structure.resource_file[resource_index];
-				resource_definition.chunk.allocate_full(resource_information_structure.chunk_index.size());
-				auto chunk_data_list = Array<ByteArray>{resource_information_structure.chunk_index.size()};
-				for (auto & chunk_index : SizeRange{resource_information_structure.chunk_index.size()}) {
-					auto & chunk_information_structure = information_structure.chunk_information[cbw<Size>(resource_information_structure.chunk_index[chunk_index])];
-					auto & chunk_definition = resource_definition.chunk[chunk_index];
-					auto & chunk_data = chunk_data_list[chunk_index];
-					data.set_position(cbw<Size>(chunk_information_structure.offset));
-					chunk_data.allocate(cbw<Size>(chunk_information_structure.size_uncompressed));
-					auto chunk_size_compressed = cbw<Size>(chunk_information_structure.size_compressed);
-					auto chunk_flag = BitSet<Structure::ChunkFlag<version>::k_count>{};
-					chunk_flag.from_integer(chunk_information_structure.flag);
-					assert_test(!chunk_flag.get(Structure::ChunkFlag<version>::unused_2));
-					auto chunk_ok = k_false;
-					if (chunk_flag.get(Structure::ChunkFlag<version>::combuf)) {
-						assert_test(!chunk_ok);
-						chunk_ok = k_true;
-						throw IncompleteException{};
-					}
-					if (chunk_flag.get(Structure::ChunkFlag<version>::dzip)) {
-						assert_test(!chunk_ok);
-						chunk_ok = k_true;
-						throw IncompleteException{};
-					}
-					if (chunk_flag.get(Structure::ChunkFlag<version>::zlib)) {
-						assert_test(!chunk_ok);
-						chunk_ok = k_true;
-						assert_test(chunk_size_compressed == chunk_data.size());
-						chunk_definition.flag = "zlib"_s;
-						auto chunk_stream = OByteStreamView{chunk_data};
-						data.forward(10_sz); // TODO NOTE : skip gzip header
-						Data::Compression::Deflate::Uncompress::process(data, chunk_stream, 15_sz, Data::Compression::Deflate::Wrapper::Constant::none());
-						assert_test(chunk_stream.full());
-					}
-					if (chunk_flag.get(Structure::ChunkFlag<version>::bzip2)) {
-						assert_test(!chunk_ok);
-						chunk_ok = k_true;
-						assert_test(chunk_size_compressed == chunk_data.size());
-						chunk_definition.flag = "bzip2"_s;
-						auto chunk_stream = OByteStreamView{chunk_data};
-						Data::Compression::BZip2::Uncompress::process(data, chunk_stream, k_false);
-						assert_test(chunk_stream.full());
-					}
-					if (chunk_flag.get(Structure::ChunkFlag<version>::mp3)) {
-						assert_test(!chunk_ok);
-						chunk_ok = k_true;
-						throw IncompleteException{};
-					}
-					if (chunk_flag.get(Structure::ChunkFlag<version>::jpeg)) {
-						assert_test(!chunk_ok);
-						chunk_ok = k_true;
-						throw IncompleteException{};
-					}
-					if (chunk_flag.get(Structure::ChunkFlag<version>::zerod_out)) {
-						assert_test(!chunk_ok);
-						chunk_ok = k_true;
-						assert_test(chunk_size_compressed == k_none_size);
-						chunk_definition.flag = "zerod_out"_s;
-						Range::assign(chunk_data, k_null_byte);
-					}
-					if (chunk_flag.get(Structure::ChunkFlag<version>::copy_coded)) {
-						assert_test(!chunk_ok);
-						chunk_ok = k_true;
-						assert_test(chunk_size_compressed == chunk_data.size());
-						chunk_definition.flag = "copy_coded"_s;
-						Range::assign_from(chunk_data, data.forward_view(chunk_data.size()));
-					}
-					if (chunk_flag.get(Structure::ChunkFlag<version>::lzma)) {
-						assert_test(!chunk_ok);
-						chunk_ok = k_true;
-						assert_test(chunk_size_compressed == chunk_data.size());
-						chunk_definition.flag = "lzma"_s;
-						auto chunk_stream = OByteStreamView{chunk_data};
-						Data::Compression::Lzma::Uncompress::process(data, chunk_stream);
-						assert_test(chunk_stream.full());
-					}
-					if (chunk_flag.get(Structure::ChunkFlag<version>::random_access)) {
-						assert_test(!chunk_ok);
-						chunk_ok = k_true;
-						throw IncompleteException{};
+				auto   resource_path = Path{information_structure.resource_directory[cbw<Size>(resource_information_structure.directory_index)]} / information_structure.resource_file[resource_index];
+				resource_index_map.emplace(resource_path.to_string(), resource_index);
+			}
+			auto resource_index_list = List<Size>{};
+			resource_index_list.allocate_full(resource.size());
+			for (auto & index : SizeRange{resource.size()}) {
+				auto iterator = resource_index_map.find(resource[index].to_string());
+				assert_test(iterator != resource_index_map.end());
+				resource_index_list[index] = iterator->second;
+			}
+			return resource_index_list;
+		}
+
+		// NOTE : only the chunks behind the requested resource are decompressed, other chunks are never touched
+		static auto process_package_partial (
+			IByteStreamView &  data,
+			List<Path> const & resource,
+			Path const &       resource_directory
+		) -> Void {
+			auto information_structure = Structure::Information<version>{};
+			process_information(data, information_structure);
+			auto resource_index_list = find_resource_index(information_structure, resource);
+			parallel_each(
+				resource_index_list.size(),
+				[&] (Size const & index) {
+					auto resource_definition = typename Definition::Resource{};
+					process_resource(
+						information_structure,
+						resource_index_list[index],
+						resource_definition,
+						make_optional_of(resource_directory),
+						[&] (Size const & chunk_index) -> CByteListView {
+							return data.view().tail(data.size() - cbw<Size>(information_structure.chunk_information[chunk_index].offset));
+						}
+					);
+				}
+			);
+			return;
+		}
+
+		// NOTE
+		// the package is never loaded as a whole, the head part of the file is read incrementally until it cover the information section, then only the ripe data of the requested chunks is read
+		// the ripe size of a chunk is not recorded, so it is taken as the distance to the next chunk offset, or to the end of file for the last one
+		static auto process_package_file_partial (
+			Path const &       data_file,
+			List<Path> const & resource,
+			Path const &       resource_directory
+		) -> Void {
+			auto data_size = FileSystem::size_file(data_file);
+			auto information_data = ByteList{};
+			auto information_size = compute_information_size(
+				[&] (Size const & size) -> CByteListView {
+					if (information_data.size() < size) {
+						assert_test(size <= data_size);
+						auto loaded_size = information_data.size();
+						auto load_size = minimum(maximum(size, maximum(loaded_size * 2_sz, k_information_read_size)), data_size) - loaded_size;
+						information_data.append_list(FileSystem::read_file_part(data_file, loaded_size, load_size));
 					}
-					assert_test(chunk_ok);
-					package_data_end_position = maximum(package_data_end_position, data.position());
+					return information_data.view();
+				}
+			);
+			auto information_structure = Structure::Information<version>{};
+			process_information(as_lvalue(IByteStreamView{information_data.view().head(information_size)}), information_structure);
+			auto resource_index_list = find_resource_index(information_structure, resource);
+			auto chunk_ripe_data_list = List<ByteArray>{};
+			chunk_ripe_data_list.allocate_full(information_structure.chunk_information.size());
+			{
+				auto chunk_offset_list = List<Size>{};
+				chunk_offset_list.allocate(information_structure.chunk_information.size() + 1_sz);
+				for (auto & chunk_information_structure : information_structure.chunk_information) {
+					chunk_offset_list.append(cbw<Size>(chunk_information_structure.offset));
 				}
-				assert_test(!chunk_data_list.empty() && Range::all_of(chunk_data_list.tail(chunk_data_list.size() - 1_sz), [&] (auto & element) { return element == chunk_data_list.first(); }));
-				if (resource_directory.has()) {
-					FileSystem::write_file(resource_directory.get() / resource_definition.path, chunk_data_list.first());
+				chunk_offset_list.append(data_size);
+				std::sort(chunk_offset_list.begin().value, chunk_offset_list.end().value);
+				auto chunk_loaded = List<Boolean>{};
+				chunk_loaded.allocate_full(information_structure.chunk_information.size());
+				Range::assign(chunk_loaded, k_false);
+				for (auto & resource_index : resource_index_list) {
+					for (auto & chunk_index_value : information_structure.resource_information[resource_index].chunk_index) {
+						auto chunk_index = cbw<Size>(chunk_index_value);
+						if (chunk_loaded[chunk_index]) {
+							continue;
+						}
+						chunk_loaded[chunk_index] = k_true;
+						auto chunk_offset = cbw<Size>(information_structure.chunk_information[chunk_index].offset);
+						auto chunk_end = *std::upper_bound(chunk_offset_list.begin().value, chunk_offset_list.end().value - 1, chunk_offset);
+						chunk_ripe_data_list[chunk_index] = FileSystem::read_file_part(data_file, chunk_offset, chunk_end - chunk_offset);
+					}
 				}
 			}
-			data.set_position(package_data_end_position);
+			parallel_each(
+				resource_index_list.size(),
+				[&] (Size const & index) {
+					auto resource_definition = typename Definition::Resource{};
+					process_resource(
+						information_structure,
+						resource_index_list[index],
+						resource_definition,
+						make_optional_of(resource_directory),
+						[&] (Size const & chunk_index) -> CByteListView {
+							return chunk_ripe_data_list[chunk_index];
+						}
+					);
+				}
+			);
 			return;
 		}
 
@@ -158,6 +374,23 @@ namespace TwinStar::Kernel::Tool::Marmalade::DZip {
 			return process_package(data, definition, resource_directory);
 		}
 
+		static auto process_partial (
+			IByteStreamView &  data_,
+			List<Path> const & resource,
+			Path const &       resource_directory
+		) -> Void {
+			M_use_zps_of(data);
+			return process_package_partial(data, resource, resource_directory);
+		}
+
+		static auto process_file_partial (
+			Path const &       data_file,
+			List<Path> const & resource,
+			Path const &       resource_directory
+		) -> Void {
+			return process_package_file_partial(data_file, resource, resource_directory);
+		}
+
 	};
 
 }
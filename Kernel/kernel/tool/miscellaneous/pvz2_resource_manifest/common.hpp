@@ -0,0 +1,116 @@
+#pragma once
+
+#include "kernel/utility/utility.hpp"
+
+namespace TwinStar::Kernel::Tool::Miscellaneous::PvZ2ResourceManifest {
+
+	// NOTE
+	// binary form of the PvZ2 resource manifest ( new type object notation ), every integer is little-endian
+	// definition is the same json as the one produced by script, key order and omitted key included
+	struct Common {
+
+		using IStream = EndianByteStreamView<StreamMode::Constant::i(), std::endian::little>;
+
+		using OStream = EndianByteStreamView<StreamMode::Constant::o(), std::endian::little>;
+
+		// ----------------
+
+		inline static constexpr auto k_group_type_composite = IntegerU8{1_iu8};
+
+		inline static constexpr auto k_group_type_simple = IntegerU8{2_iu8};
+
+		inline static constexpr auto k_group_type_count = IntegerU8{2_iu8};
+
+		// ----------------
+
+		inline static constexpr auto k_resource_type_image = IntegerU8{1_iu8};
+
+		inline static constexpr auto k_resource_type_count = IntegerU8{7_iu8};
+
+		// ----------------
+
+		static auto group_type_name (
+			IntegerU8 const & index
+		) -> String {
+			switch (index.value) {
+				case 1 : {
+					return "composite"_s;
+				}
+				case 2 : {
+					return "simple"_s;
+				}
+				default : {
+					assert_fail(R"(/* group type index is valid */)");
+				}
+			}
+		}
+
+		static auto group_type_index (
+			String const & name
+		) -> IntegerU8 {
+			for (auto index = 1_iu8; index <= k_group_type_count; ++index) {
+				if (group_type_name(index) == name) {
+					return index;
+				}
+			}
+			assert_fail(R"(/* group type name is valid */)");
+		}
+
+		// ----------------
+
+		static auto resource_type_name (
+			IntegerU8 const & index
+		) -> String {
+			switch (index.value) {
+				case 1 : {
+					return "Image"_s;
+				}
+				case 2 : {
+					return "PopAnim"_s;
+				}
+				case 3 : {
+					return "SoundBank"_s;
+				}
+				case 4 : {
+					return "File"_s;
+				}
+				case 5 : {
+					return "PrimeFont"_s;
+				}
+				case 6 : {
+					return "RenderEffect"_s;
+				}
+				case 7 : {
+					return "DecodedSoundBank"_s;
+				}
+				default : {
+					assert_fail(R"(/* resource type index is valid */)");
+				}
+			}
+		}
+
+		static auto resource_type_index (
+			String const & name
+		) -> IntegerU8 {
+			for (auto index = 1_iu8; index <= k_resource_type_count; ++index) {
+				if (resource_type_name(index) == name) {
+					return index;
+				}
+			}
+			assert_fail(R"(/* resource type name is valid */)");
+		}
+
+		// ----------------
+
+		static auto make_member (
+			JSON::Object & object,
+			String const & key
+		) -> JSON::Value & {
+			auto & member = object.append();
+			member.key = key;
+			return member.value;
+		}
+
+	};
+
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "kernel/utility/utility.hpp"
+#include "kernel/tool/miscellaneous/pvz2_resource_manifest/common.hpp"
+
+namespace TwinStar::Kernel::Tool::Miscellaneous::PvZ2ResourceManifest {
+
+	struct Decode :
+		Common {
+
+		using Common = Common;
+
+		// ----------------
+
+		static auto read_enumeration (
+			IStream & data
+		) -> IntegerU8 {
+			return data.read_of<IntegerU8>();
+		}
+
+		static auto read_boolean (
+			IStream & data
+		) -> Boolean {
+			auto value = data.read_of<IntegerU8>();
+			assert_test(value == 0x00_iu8 || value == 0x01_iu8);
+			return mbw<Boolean>(value == 0x01_iu8);
+		}
+
+		static auto read_integer (
+			IStream & data
+		) -> Integer {
+			return cbw<Integer>(data.read_of<IntegerS32>());
+		}
+
+		static auto read_string (
+			IStream &      data,
+			JSON::Value & value
+		) -> Void {
+			auto size = cbw<Size>(data.read_of<IntegerU32>());
+			auto content = CStringView{};
+			StringParser::read_utf8_string_by_size(self_cast<ICharacterStreamView>(data), content, as_lvalue(Size{}), size);
+			value.set_string(content);
+			return;
+		}
+
+		// ----------------
+
+		static auto process_resource (
+			IStream &      data,
+			JSON::Object & resource
+		) -> Void {
+			auto type = read_enumeration(data);
+			auto slot = read_integer(data);
+			auto width = read_integer(data);
+			auto height = read_integer(data);
+			auto x = read_integer(data);
+			auto y = read_integer(data);
+			auto ax = read_integer(data);
+			auto ay = read_integer(data);
+			auto aw = read_integer(data);
+			auto ah = read_integer(data);
+			auto cols = read_integer(data);
+			auto rows = read_integer(data);
+			auto atlas = read_boolean(data);
+			assert_test(read_boolean(data));
+			assert_test(read_boolean(data));
+			auto has_parent = read_boolean(data);
+			make_member(resource, "slot"_s).set_number(slot);
+			read_string(data, make_member(resource, "id"_s));
+			read_string(data, make_member(resource, "path"_s));
+			make_member(resource, "type"_s).set_string(resource_type_name(type));
+			if (!has_parent) {
+				if (type == k_resource_type_image) {
+					make_member(resource, "atlas"_s).set_boolean(atlas);
+					make_member(resource, "width"_s).set_number(width);
+					make_member(resource, "height"_s).set_number(height);
+				}
+			}
+			else {
+				// NOTE : parent is always read, but only kept for image
+				auto parent = JSON::Value{};
+				read_string(data, parent);
+				if (type == k_resource_type_image) {
+					make_member(resource, "parent"_s) = as_moveable(parent);
+					make_member(resource, "ax"_s).set_number(ax);
+					make_member(resource, "ay"_s).set_number(ay);
+					make_member(resource, "aw"_s).set_number(aw);
+					make_member(resource, "ah"_s).set_number(ah);
+					make_member(resource, "x"_s).set_number(x);
+					make_member(resource, "y"_s).set_number(y);
+					make_member(resource, "rows"_s).set_number(rows);
+					make_member(resource, "cols"_s).set_number(cols);
+				}
+			}
+			return;
+		}
+
+		static auto process_group (
+			IStream &      data,
+			JSON::Object & group
+		) -> Void {
+			auto type = read_enumeration(data);
+			auto res = read_integer(data);
+			auto subgroup_count = cbw<Size>(read_integer(data));
+			auto resource_count = cbw<Size>(read_integer(data));
+			assert_test(read_boolean(data));
+			auto has_parent = read_boolean(data);
+			read_string(data, make_member(group, "id"_s));
+			make_member(group, "type"_s).set_string(group_type_name(type));
+			auto parent = JSON::Value{};
+			if (has_parent) {
+				read_string(data, parent);
+			}
+			if (type == k_group_type_composite) {
+				assert_test(resource_count == 0_sz);
+				auto & subgroup_list = make_member(group, "subgroups"_s).set_array();
+				subgroup_list.allocate(subgroup_count);
+				for (auto & subgroup_index : SizeRange{subgroup_count}) {
+					auto & subgroup = subgroup_list.append().set_object();
+					auto   subgroup_res = read_integer(data);
+					read_string(data, make_member(subgroup, "id"_s));
+					if (subgroup_res != 0_i) {
+						make_member(subgroup, "res"_s).set_number(subgroup_res);
+					}
+				}
+			}
+			if (type == k_group_type_simple) {
+				assert_test(subgroup_count == 0_sz);
+				if (res != 0_i) {
+					make_member(group, "res"_s).set_number(res);
+				}
+				if (has_parent) {
+					make_member(group, "parent"_s) = as_moveable(parent);
+				}
+				auto & resource_list = make_member(group, "resources"_s).set_array();
+				resource_list.allocate(resource_count);
+				for (auto & resource_index : SizeRange{resource_count}) {
+					process_resource(data, resource_list.append().set_object());
+				}
+			}
+			return;
+		}
+
+		// ----------------
+
+		static auto process_whole (
+			IStream &     data,
+			JSON::Value & definition
+		) -> Void {
+			auto & definition_object = definition.set_object();
+			make_member(definition_object, "slot_count"_s).set_number(read_integer(data));
+			auto   group_count = cbw<Size>(read_integer(data));
+			auto & group_list = make_member(definition_object, "groups"_s).set_array();
+			group_list.allocate(group_count);
+			for (auto & group_index : SizeRange{group_count}) {
+				process_group(data, group_list.append().set_object());
+			}
+			return;
+		}
+
+		// ----------------
+
+		static auto process (
+			IByteStreamView & data_,
+			JSON::Value &     definition
+		) -> Void {
+			M_use_zps_of(data);
+			restruct(definition);
+			return process_whole(as_endian_byte_stream<std::endian::little>(data), definition);
+		}
+
+	};
+
+}
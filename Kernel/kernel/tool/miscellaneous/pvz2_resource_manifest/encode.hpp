@@ -0,0 +1,171 @@
+#pragma once
+
+#include "kernel/utility/utility.hpp"
+#include "kernel/tool/miscellaneous/pvz2_resource_manifest/common.hpp"
+
+namespace TwinStar::Kernel::Tool::Miscellaneous::PvZ2ResourceManifest {
+
+	struct Encode :
+		Common {
+
+		using Common = Common;
+
+		// ----------------
+
+		static auto write_enumeration (
+			OStream &         data,
+			IntegerU8 const & value
+		) -> Void {
+			data.write(value);
+			return;
+		}
+
+		static auto write_boolean (
+			OStream &       data,
+			Boolean const & value
+		) -> Void {
+			data.write(!value ? 0x00_iu8 : 0x01_iu8);
+			return;
+		}
+
+		static auto write_integer (
+			OStream &       data,
+			Integer const & value
+		) -> Void {
+			data.write(cbw<IntegerS32>(value));
+			return;
+		}
+
+		// NOTE : the size prefix is the byte size of the utf-8 content, the same as what decode expect
+		static auto write_string (
+			OStream &            data,
+			JSON::String const & value
+		) -> Void {
+			data.write(cbw<IntegerU32>(value.size()));
+			StringParser::write_utf8_string(self_cast<OCharacterStreamView>(data), value.as_view(), as_lvalue(Size{}));
+			return;
+		}
+
+		// ----------------
+
+		static auto get_integer_or (
+			JSON::Object const & object,
+			String const &       key,
+			Integer const &      fallback
+		) -> Integer {
+			if (auto member = object.query_if(key)) {
+				return member.get().value.get_number().get_integer();
+			}
+			return fallback;
+		}
+
+		// ----------------
+
+		static auto process_resource (
+			OStream &            data,
+			JSON::Object const & resource
+		) -> Void {
+			auto type = resource_type_index(resource["type"_s].get_string());
+			auto parent = resource.query_if("parent"_s);
+			write_enumeration(data, type);
+			write_integer(data, resource["slot"_s].get_number().get_integer());
+			write_integer(data, get_integer_or(resource, "width"_s, 0_i));
+			write_integer(data, get_integer_or(resource, "height"_s, 0_i));
+			write_integer(data, get_integer_or(resource, "x"_s, 0_i));
+			write_integer(data, type != k_resource_type_image || !parent ? 0x7FFFFFFF_i : get_integer_or(resource, "y"_s, 0_i));
+			write_integer(data, get_integer_or(resource, "ax"_s, 0_i));
+			write_integer(data, get_integer_or(resource, "ay"_s, 0_i));
+			write_integer(data, get_integer_or(resource, "aw"_s, 0_i));
+			write_integer(data, get_integer_or(resource, "ah"_s, 0_i));
+			write_integer(data, get_integer_or(resource, "cols"_s, 1_i));
+			write_integer(data, get_integer_or(resource, "rows"_s, 1_i));
+			if (auto atlas = resource.query_if("atlas"_s)) {
+				write_boolean(data, atlas.get().value.get_boolean());
+			}
+			else {
+				write_boolean(data, k_false);
+			}
+			write_boolean(data, k_true);
+			write_boolean(data, k_true);
+			write_boolean(data, parent.has());
+			write_string(data, resource["id"_s].get_string());
+			auto & path = resource["path"_s];
+			if (path.is_string()) {
+				write_string(data, path.get_string());
+			}
+			else {
+				auto path_string = String{};
+				for (auto & path_element : path.get_array()) {
+					if (!path_string.empty()) {
+						path_string.append('\\'_c);
+					}
+					path_string.append_list(path_element.get_string());
+				}
+				write_string(data, path_string);
+			}
+			if (parent) {
+				write_string(data, parent.get().value.get_string());
+			}
+			return;
+		}
+
+		static auto process_group (
+			OStream &            data,
+			JSON::Object const & group
+		) -> Void {
+			auto type = group_type_index(group["type"_s].get_string());
+			auto subgroup = group.query_if("subgroups"_s);
+			auto resource = group.query_if("resources"_s);
+			auto parent = group.query_if("parent"_s);
+			auto subgroup_count = !subgroup ? k_none_size : subgroup.get().value.get_array().size();
+			auto resource_count = !resource ? k_none_size : resource.get().value.get_array().size();
+			write_enumeration(data, type);
+			write_integer(data, get_integer_or(group, "res"_s, 0_i));
+			write_integer(data, cbw<Integer>(subgroup_count));
+			write_integer(data, cbw<Integer>(resource_count));
+			write_boolean(data, k_true);
+			write_boolean(data, parent.has());
+			write_string(data, group["id"_s].get_string());
+			if (parent) {
+				write_string(data, parent.get().value.get_string());
+			}
+			for (auto & subgroup_index : SizeRange{subgroup_count}) {
+				auto & subgroup_object = subgroup.get().value.get_array()[subgroup_index].get_object();
+				write_integer(data, get_integer_or(subgroup_object, "res"_s, 0_i));
+				write_string(data, subgroup_object["id"_s].get_string());
+			}
+			for (auto & resource_index : SizeRange{resource_count}) {
+				process_resource(data, resource.get().value.get_array()[resource_index].get_object());
+			}
+			return;
+		}
+
+		// ----------------
+
+		static auto process_whole (
+			OStream &           data,
+			JSON::Value const & definition
+		) -> Void {
+			auto & definition_object = definition.get_object();
+			auto & group_list = definition_object["groups"_s].get_array();
+			write_integer(data, definition_object["slot_count"_s].get_number().get_integer());
+			write_integer(data, cbw<Integer>(group_list.size()));
+			for (auto & group : group_list) {
+				process_group(data, group.get_object());
+			}
+			return;
+		}
+
+		// ----------------
+
+		static auto process (
+			OByteStreamView &   data_,
+			JSON::Value const & definition
+		) -> Void {
+			M_use_zps_of(data);
+			return process_whole(as_endian_byte_stream<std::endian::little>(data), definition);
+		}
+
+	};
+
+}
@@ -0,0 +1,443 @@
+#pragma once
+
+#include "kernel/utility/utility.hpp"
+#include "kernel/tool/popcap/animation/version.hpp"
+#include "kernel/tool/popcap/animation/definition.hpp"
+#include "kernel/tool/data/serialization/xml/read.hpp"
+#include "kernel/tool/data/serialization/xml/write.hpp"
+#include <cmath>
+#include <numbers>
+
+namespace TwinStar::Kernel::Tool::PopCap::Animation::Convert::Flash {
+
+	#pragma region extra information
+
+	M_record_of_list(
+		M_wrap(WorkAreaExtraInformation),
+		M_wrap(
+			(Integer) start,
+			(Integer) duration,
+		),
+	);
+
+	// ----------------
+
+	M_record_of_map(
+		M_wrap(ImageExtraInformation),
+		M_wrap(
+			(String) name,
+			(Size2<Integer>) size,
+		),
+	);
+
+	// ----------------
+
+	M_record_of_map(
+		M_wrap(SpriteExtraInformation),
+		M_wrap(
+			(String) name,
+			(Floater) frame_rate,
+			(Optional<WorkAreaExtraInformation>) work_area,
+		),
+	);
+
+	// ----------------
+
+	M_record_of_map(
+		M_wrap(ExtraInformation),
+		M_wrap(
+			(Position2<Floater>) position,
+			(List<ImageExtraInformation>) image,
+			(List<SpriteExtraInformation>) sprite,
+			(Optional<SpriteExtraInformation>) main_sprite,
+		),
+	);
+
+	#pragma endregion
+
+	template <auto version> requires (check_version(version, {}))
+	struct Common {
+
+		using Definition = Definition<version>;
+
+		// ----------------
+
+		using StandardTransform = typename Definition::MatrixTranslateTransform;
+
+		using Color = typename Definition::Color;
+
+		// ----------------
+
+		using XMLEventType = Data::Serialization::XML::EventType;
+
+		using XMLReader = Data::Serialization::XML::Read::Reader;
+
+		using XMLWriter = Data::Serialization::XML::Write::Writer;
+
+		using XMLAttribute = Map<CStringView, CStringView>;
+
+		// ----------------
+
+		inline static auto const k_xfl_version = CStringView{"2.971"_sv};
+
+		inline static auto const k_xmlns_xsi = CStringView{"http://www.w3.org/2001/XMLSchema-instance"_sv};
+
+		inline static auto const k_xmlns = CStringView{"http://ns.adobe.com/xfl/2008/"_sv};
+
+		// ----------------
+
+		inline static constexpr auto k_transform_tolerance = Floater{1.0e-2_f};
+
+		#pragma region transform
+
+		static auto make_initial_transform (
+		) -> StandardTransform {
+			auto result = StandardTransform{};
+			result.a = 1.0_f;
+			result.b = 0.0_f;
+			result.c = 0.0_f;
+			result.d = 1.0_f;
+			result.x = 0.0_f;
+			result.y = 0.0_f;
+			return result;
+		}
+
+		static auto make_initial_color (
+		) -> Color {
+			auto result = Color{};
+			result.red = 1.0_f;
+			result.green = 1.0_f;
+			result.blue = 1.0_f;
+			result.alpha = 1.0_f;
+			return result;
+		}
+
+		// ----------------
+
+		static auto convert_transform_from_rotate_to_standard (
+			typename Definition::RotateTranslateTransform const & source,
+			StandardTransform &                                   destination
+		) -> Void {
+			auto cos = mbw<Floater>(std::cos(source.angle.value));
+			auto sin = mbw<Floater>(std::sin(source.angle.value));
+			destination.a = cos;
+			destination.b = sin;
+			destination.c = -sin;
+			destination.d = cos;
+			destination.x = source.x;
+			destination.y = source.y;
+			return;
+		}
+
+		static auto convert_transform_from_variant_to_standard (
+			typename Definition::VariantTransform const & source,
+			StandardTransform &                           destination
+		) -> Void {
+			if (source.template is<typename Definition::TranslateTransform>()) {
+				auto & source_value = source.template get<typename Definition::TranslateTransform>();
+				destination = make_initial_transform();
+				destination.x = source_value.x;
+				destination.y = source_value.y;
+			}
+			else if (source.template is<typename Definition::RotateTranslateTransform>()) {
+				convert_transform_from_rotate_to_standard(source.template get<typename Definition::RotateTranslateTransform>(), destination);
+			}
+			else if (source.template is<typename Definition::MatrixTranslateTransform>()) {
+				destination = source.template get<typename Definition::MatrixTranslateTransform>();
+			}
+			else {
+				assert_fail(R"(/* transform type is valid */)");
+			}
+			return;
+		}
+
+		// NOTE : angle of a rotate matrix, the result is not checked
+		static auto compute_rotate_angle (
+			StandardTransform const & source
+		) -> Floater {
+			auto cos = source.a.value;
+			auto sin = source.b.value;
+			return mbw<Floater>(std::atan(sin / cos) + std::numbers::pi * (cos >= 0.0 ? (0.0) : (sin >= 0.0 ? (+1.0) : (-1.0))));
+		}
+
+		static auto test_rotate_angle (
+			StandardTransform const & source,
+			Floater const &           angle
+		) -> Boolean {
+			return mbw<Boolean>(std::abs(std::sin(angle.value) - source.b.value) < k_transform_tolerance.value && std::abs(std::cos(angle.value) - source.a.value) < k_transform_tolerance.value);
+		}
+
+		static auto convert_transform_from_standard_to_rotate (
+			StandardTransform const &                       source,
+			typename Definition::RotateTranslateTransform & destination
+		) -> Void {
+			assert_test(source.a == source.d && source.b == -source.c);
+			auto angle = compute_rotate_angle(source);
+			assert_test(test_rotate_angle(source, angle));
+			destination.angle = angle;
+			destination.x = source.x;
+			destination.y = source.y;
+			return;
+		}
+
+		static auto convert_transform_from_standard_to_variant (
+			StandardTransform const &               source,
+			typename Definition::VariantTransform & destination
+		) -> Void {
+			if (source.a == source.d && source.b == -source.c) {
+				if (source.a == 1.0_f && source.b == 0.0_f) {
+					auto & destination_value = destination.template set<typename Definition::TranslateTransform>();
+					destination_value.x = source.x;
+					destination_value.y = source.y;
+					return;
+				}
+				auto angle = compute_rotate_angle(source);
+				if (test_rotate_angle(source, angle)) {
+					auto & destination_value = destination.template set<typename Definition::RotateTranslateTransform>();
+					destination_value.angle = angle;
+					destination_value.x = source.x;
+					destination_value.y = source.y;
+					return;
+				}
+			}
+			destination.template set<typename Definition::MatrixTranslateTransform>() = source;
+			return;
+		}
+
+		#pragma endregion
+
+		#pragma region image name
+
+		// NOTE : the media name of an image, drop the "(...)" and "[...]" part, the part before '$' and the part after '|'
+		static auto parse_image_file_name (
+			String const & value
+		) -> String {
+			auto result = String{value};
+			auto index_a_1 = Range::find_index(result, '('_c);
+			auto index_a_2 = Range::find_index(result, ')'_c);
+			if (index_a_1.has() || index_a_2.has()) {
+				assert_test(index_a_1.has() && index_a_2.has() && index_a_1.get() < index_a_2.get());
+				result = String{result.head(index_a_1.get())} + result.tail(result.size() - index_a_2.get() - 1_sz);
+			}
+			auto index_b_1 = Range::find_index(result, '$'_c);
+			if (index_b_1.has()) {
+				assert_test(!index_a_1.has() && !index_a_2.has());
+				result = String{result.tail(result.size() - index_b_1.get() - 1_sz)};
+			}
+			auto index_c_1 = Range::find_index(result, '['_c);
+			auto index_c_2 = Range::find_index(result, ']'_c);
+			if (index_c_1.has() || index_c_2.has()) {
+				assert_test(index_c_1.has() && index_c_2.has() && index_c_1.get() < index_c_2.get());
+				result = String{result.head(index_c_1.get())} + result.tail(result.size() - index_c_2.get() - 1_sz);
+			}
+			auto index_d_1 = Range::find_index(result, '|'_c);
+			if (index_d_1.has()) {
+				result = String{result.head(index_d_1.get())};
+			}
+			return result;
+		}
+
+		#pragma endregion
+
+		#pragma region number
+
+		// NOTE
+		// the same text as Number.prototype.toFixed(6) of java-script, negative zero is printed as zero
+		// the exact value is rounded, but a tie is rounded away from zero instead of to even; a tie only happen at an odd multiple of 1/128, where value * 10^6 is exact
+		static auto format_fixed_floater (
+			Floater const & value
+		) -> String {
+			auto scaled_value = value.value * 128.0;
+			if (std::abs(value.value) < 0x1.0p32 && std::trunc(scaled_value) == scaled_value && std::fmod(scaled_value, 2.0) != 0.0) {
+				auto digit = mbw<IntegerU64>(static_cast<std::uint64_t>(std::abs(value.value) * 1000000.0)) + 1_iu64;
+				return "{}{}.{:06}"_sf(value < 0.0_f ? ("-"_sv) : (""_sv), digit / 1000000_iu64, digit % 1000000_iu64);
+			}
+			return "{:.6f}"_sf(value + 0.0_f);
+		}
+
+		static auto parse_integer (
+			CStringView const & string
+		) -> Integer {
+			auto value = Integer{};
+			auto parse_result = mscharconv::from_chars(cast_pointer<char>(string.begin()).value, cast_pointer<char>(string.end()).value, value.value, 10);
+			assert_test(parse_result.ec == std::errc{} && parse_result.ptr == cast_pointer<char>(string.end()).value);
+			return value;
+		}
+
+		static auto parse_floater (
+			CStringView const & string
+		) -> Floater {
+			auto value = Floater{};
+			auto parse_result = mscharconv::from_chars(cast_pointer<char>(string.begin()).value, cast_pointer<char>(string.end()).value, value.value, mscharconv::chars_format::general);
+			assert_test(parse_result.ec == std::errc{} && parse_result.ptr == cast_pointer<char>(string.end()).value);
+			return value;
+		}
+
+		#pragma endregion
+
+		#pragma region xml
+
+		static auto push_xmlns_attribute (
+			XMLWriter & writer
+		) -> Void {
+			writer.push_attribute("xmlns:xsi"_sv, k_xmlns_xsi);
+			writer.push_attribute("xmlns"_sv, k_xmlns);
+			return;
+		}
+
+		// ----------------
+
+		static auto find_attribute (
+			XMLAttribute const & attribute,
+			CStringView const &  name
+		) -> Optional<CStringView> {
+			auto value = attribute.query_if(name);
+			return !value ? (k_null_optional) : (make_optional_of(CStringView{value.get().value}));
+		}
+
+		static auto find_attribute_or (
+			XMLAttribute const & attribute,
+			CStringView const &  name,
+			CStringView const &  fallback
+		) -> CStringView {
+			auto value = find_attribute(attribute, name);
+			return !value.has() ? (fallback) : (value.get());
+		}
+
+		static auto get_attribute (
+			XMLAttribute const & attribute,
+			CStringView const &  name
+		) -> CStringView {
+			auto value = find_attribute(attribute, name);
+			assert_test(value.has());
+			return value.get();
+		}
+
+		// ----------------
+
+		// NOTE
+		// read the child of the element that just begin, until the end of the element, or until the end of the document if no element is opened
+		// executor(name, attribute) is called at the begin of every child element, the rest of the child element that the executor does not read is skipped
+		// the name and attribute keep valid only until the executor read the reader
+		template <typename Executor> requires
+			CategoryConstraint<IsPureInstance<Executor>>
+			&& (IsGenericCallable<Executor>)
+		static auto read_child_element (
+			XMLReader &      reader,
+			Executor const & executor
+		) -> Void {
+			auto depth = reader.depth();
+			while (k_true) {
+				auto event = reader.next();
+				if (event == XMLEventType::Constant::element_end() || event == XMLEventType::Constant::document_end()) {
+					break;
+				}
+				if (event == XMLEventType::Constant::element_begin()) {
+					executor(reader.name(), reader.attribute());
+					while (reader.depth() > depth) {
+						reader.next();
+					}
+				}
+			}
+			return;
+		}
+
+		// NOTE : executor(attribute) is called for the child element if it exist, more than one such child element is not allowed
+		template <typename Executor> requires
+			CategoryConstraint<IsPureInstance<Executor>>
+			&& (IsGenericCallable<Executor>)
+		static auto read_child_element_unique_or_none (
+			XMLReader &         reader,
+			CStringView const & name,
+			Executor const &    executor
+		) -> Boolean {
+			auto found = k_false;
+			read_child_element(
+				reader,
+				[&] (
+					CStringView const &  child_name,
+					XMLAttribute const & child_attribute
+				) -> Void {
+					if (child_name == name) {
+						assert_test(!found);
+						found = k_true;
+						executor(child_attribute);
+					}
+					return;
+				}
+			);
+			return found;
+		}
+
+		template <typename Executor> requires
+			CategoryConstraint<IsPureInstance<Executor>>
+			&& (IsGenericCallable<Executor>)
+		static auto read_child_element_unique (
+			XMLReader &         reader,
+			CStringView const & name,
+			Executor const &    executor
+		) -> Void {
+			auto found = read_child_element_unique_or_none(reader, name, executor);
+			assert_test(found);
+			return;
+		}
+
+		// NOTE : the element that just begin must contain only one text node
+		static auto read_child_text (
+			XMLReader & reader
+		) -> String {
+			auto event = reader.next();
+			assert_test(event == XMLEventType::Constant::text());
+			auto result = String{reader.value()};
+			event = reader.next();
+			assert_test(event == XMLEventType::Constant::element_end());
+			return result;
+		}
+
+		// ----------------
+
+		template <typename Executor> requires
+			CategoryConstraint<IsPureInstance<Executor>>
+			&& (IsGenericCallable<Executor>)
+		static auto write_document (
+			Path const &     path,
+			Executor const & executor
+		) -> Void {
+			auto data = String{};
+			auto writer = XMLWriter{data};
+			executor(writer);
+			FileSystem::write_file(path, to_byte_view(data.as_view()));
+			return;
+		}
+
+		// NOTE : executor(reader, attribute) is called for the root element, which must be named as root_name
+		template <typename Executor> requires
+			CategoryConstraint<IsPureInstance<Executor>>
+			&& (IsGenericCallable<Executor>)
+		static auto read_document (
+			Path const &        path,
+			CStringView const & root_name,
+			Executor const &    executor
+		) -> Void {
+			auto data_byte = FileSystem::read_file(path);
+			auto data = String{};
+			data.bind(from_byte_view<Character>(data_byte.view()));
+			data_byte.unbind();
+			auto reader = XMLReader{data};
+			read_child_element_unique(
+				reader,
+				root_name,
+				[&] (
+					XMLAttribute const & attribute
+				) -> Void {
+					return executor(reader, attribute);
+				}
+			);
+			return;
+		}
+
+		#pragma endregion
+
+	};
+
+}
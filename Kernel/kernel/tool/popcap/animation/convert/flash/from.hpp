@@ -0,0 +1,595 @@
+#pragma once
+
+#include "kernel/utility/utility.hpp"
+#include "kernel/tool/popcap/animation/convert/flash/common.hpp"
+#include <map>
+
+namespace TwinStar::Kernel::Tool::PopCap::Animation::Convert::Flash {
+
+	template <auto version> requires (check_version(version, {}))
+	struct From :
+		Common<version> {
+
+		using Common = Common<version>;
+
+		using typename Common::Definition;
+
+		using typename Common::StandardTransform;
+
+		using typename Common::Color;
+
+		using typename Common::XMLWriter;
+
+		using Common::k_xfl_version;
+
+		using Common::make_initial_transform;
+
+		using Common::make_initial_color;
+
+		using Common::convert_transform_from_rotate_to_standard;
+
+		using Common::convert_transform_from_variant_to_standard;
+
+		using Common::parse_image_file_name;
+
+		using Common::format_fixed_floater;
+
+		using Common::push_xmlns_attribute;
+
+		using Common::write_document;
+
+		// ----------------
+
+		struct LayerModel {
+			Optional<Boolean> state;
+			Integer           resource;
+			Boolean           sprite;
+			StandardTransform transform;
+			Color             color;
+			Integer           frame_start;
+			Integer           frame_duration;
+		};
+
+		struct InstanceModel {
+			String            name;
+			Optional<Size>    first_frame;
+			StandardTransform transform;
+			Color             color;
+		};
+
+		// NOTE : a frame without instance is the placeholder that hold the layer until the first change
+		struct FrameModel {
+			Size                    index;
+			Integer                 duration;
+			Optional<InstanceModel> instance;
+		};
+
+		// ----------------
+
+		static auto write_matrix_element (
+			XMLWriter &               writer,
+			StandardTransform const & transform
+		) -> Void {
+			writer.open_element("matrix"_sv);
+			writer.open_element("Matrix"_sv);
+			writer.push_attribute("a"_sv, format_fixed_floater(transform.a));
+			writer.push_attribute("b"_sv, format_fixed_floater(transform.b));
+			writer.push_attribute("c"_sv, format_fixed_floater(transform.c));
+			writer.push_attribute("d"_sv, format_fixed_floater(transform.d));
+			writer.push_attribute("tx"_sv, format_fixed_floater(transform.x));
+			writer.push_attribute("ty"_sv, format_fixed_floater(transform.y));
+			writer.close_element();
+			writer.close_element();
+			return;
+		}
+
+		static auto write_color_element (
+			XMLWriter &   writer,
+			Color const & color
+		) -> Void {
+			writer.open_element("color"_sv);
+			writer.open_element("Color"_sv);
+			writer.push_attribute("redMultiplier"_sv, format_fixed_floater(color.red));
+			writer.push_attribute("greenMultiplier"_sv, format_fixed_floater(color.green));
+			writer.push_attribute("blueMultiplier"_sv, format_fixed_floater(color.blue));
+			writer.push_attribute("alphaMultiplier"_sv, format_fixed_floater(color.alpha));
+			writer.close_element();
+			writer.close_element();
+			return;
+		}
+
+		// NOTE : DOMFrame > elements, both are left opened
+		static auto open_frame_element (
+			XMLWriter &            writer,
+			Size const &           index,
+			Optional<Size> const & duration
+		) -> Void {
+			writer.open_element("DOMFrame"_sv);
+			writer.push_attribute("index"_sv, "{}"_sf(index));
+			if (duration.has()) {
+				writer.push_attribute("duration"_sv, "{}"_sf(duration.get()));
+			}
+			writer.open_element("elements"_sv);
+			return;
+		}
+
+		static auto close_frame_element (
+			XMLWriter & writer
+		) -> Void {
+			writer.close_element();
+			writer.close_element();
+			return;
+		}
+
+		static auto write_frame_element (
+			XMLWriter &            writer,
+			Size const &           index,
+			Optional<Size> const & duration
+		) -> Void {
+			open_frame_element(writer, index, duration);
+			close_frame_element(writer);
+			return;
+		}
+
+		// NOTE : DOMSymbolItem > timeline > DOMTimeline > layers, all are left opened
+		static auto open_symbol_document (
+			XMLWriter &         writer,
+			CStringView const & item_name,
+			CStringView const & timeline_name
+		) -> Void {
+			writer.open_element("DOMSymbolItem"_sv);
+			push_xmlns_attribute(writer);
+			writer.push_attribute("name"_sv, item_name);
+			writer.push_attribute("symbolType"_sv, "graphic"_sv);
+			writer.open_element("timeline"_sv);
+			writer.open_element("DOMTimeline"_sv);
+			writer.push_attribute("name"_sv, timeline_name);
+			writer.open_element("layers"_sv);
+			return;
+		}
+
+		static auto close_symbol_document (
+			XMLWriter & writer
+		) -> Void {
+			writer.close_element();
+			writer.close_element();
+			writer.close_element();
+			writer.close_element();
+			return;
+		}
+
+		// ----------------
+
+		static auto process_image (
+			XMLWriter &                        writer,
+			ImageExtraInformation &            extra,
+			typename Definition::Image const & image,
+			Size const &                       index
+		) -> Void {
+			auto transform = StandardTransform{};
+			if constexpr (check_version(version, {1, 2})) {
+				convert_transform_from_rotate_to_standard(image.transform, transform);
+			}
+			if constexpr (check_version(version, {2})) {
+				transform = image.transform;
+			}
+			open_symbol_document(writer, "image/image_{}"_sf(index + 1_sz), "image_{}"_sf(index + 1_sz));
+			writer.open_element("DOMLayer"_sv);
+			writer.open_element("frames"_sv);
+			open_frame_element(writer, k_begin_index, k_null_optional);
+			writer.open_element("DOMSymbolInstance"_sv);
+			writer.push_attribute("libraryItemName"_sv, "source/source_{}"_sf(index + 1_sz));
+			writer.push_attribute("symbolType"_sv, "graphic"_sv);
+			writer.push_attribute("loop"_sv, "loop"_sv);
+			write_matrix_element(writer, transform);
+			writer.close_element();
+			close_frame_element(writer);
+			writer.close_element();
+			writer.close_element();
+			close_symbol_document(writer);
+			extra.name = image.name;
+			if constexpr (check_version(version, {1, 4})) {
+				extra.size.width = 0_i;
+				extra.size.height = 0_i;
+			}
+			if constexpr (check_version(version, {4})) {
+				extra.size = image.size;
+			}
+			return;
+		}
+
+		// NOTE
+		// every layer of the sprite become a DOMLayer, a DOMFrame is created when the layer changed, and last until the next change or remove
+		// the duration of a frame is known only after the next change, so the frames are collected before written
+		// the main sprite has no index
+		static auto process_sprite (
+			XMLWriter &                               writer,
+			SpriteExtraInformation &                  extra,
+			typename Definition::Sprite const &       sprite,
+			Optional<Size> const &                    index,
+			List<typename Definition::Sprite> const & sub_sprite
+		) -> Void {
+			auto model = std::map<Integer, LayerModel>{};
+			auto layer_frame_list = std::map<Integer, List<FrameModel>>{};
+			for (auto frame_index : SizeRange{sprite.frame.size()}) {
+				auto & frame = sprite.frame[frame_index];
+				for (auto & remove : frame.remove) {
+					auto layer = model.find(remove.index);
+					assert_test(layer != model.end());
+					layer->second.state.set(k_false);
+				}
+				for (auto & append : frame.append) {
+					model[append.index] = LayerModel{
+						.state = k_null_optional,
+						.resource = append.resource,
+						.sprite = append.sprite,
+						.transform = make_initial_transform(),
+						.color = make_initial_color(),
+						.frame_start = cbw<Integer>(frame_index),
+						.frame_duration = cbw<Integer>(frame_index),
+					};
+					auto & frame_list = layer_frame_list[append.index];
+					frame_list.reset();
+					if (frame_index > k_begin_index) {
+						frame_list.append(
+							FrameModel{
+								.index = k_begin_index,
+								.duration = cbw<Integer>(frame_index),
+								.instance = k_null_optional,
+							}
+						);
+					}
+				}
+				for (auto & change : frame.change) {
+					auto layer = model.find(change.index);
+					assert_test(layer != model.end());
+					layer->second.state.set(k_true);
+					convert_transform_from_variant_to_standard(change.transform, layer->second.transform);
+					if (change.color.has()) {
+						layer->second.color = change.color.get();
+					}
+				}
+				for (auto layer_iterator = model.begin(); layer_iterator != model.end();) {
+					auto & layer = layer_iterator->second;
+					auto & frame_list = layer_frame_list[layer_iterator->first];
+					if (layer.state.has() && !frame_list.empty()) {
+						frame_list.last().duration = layer.frame_duration;
+					}
+					if (layer.state.has() && layer.state.get()) {
+						auto & instance = frame_list.append(
+							FrameModel{
+								.index = frame_index,
+								.duration = 0_i,
+								.instance = k_null_optional,
+							}
+						).instance.set();
+						if (!layer.sprite) {
+							instance.name = "image/image_{}"_sf(layer.resource + 1_i);
+							instance.first_frame.reset();
+						}
+						else {
+							auto & sub_sprite_frame = sub_sprite[cbw<Size>(layer.resource)].frame;
+							assert_test(!sub_sprite_frame.empty());
+							instance.name = "sprite/sprite_{}"_sf(layer.resource + 1_i);
+							instance.first_frame.set((frame_index - cbw<Size>(layer.frame_start)) % sub_sprite_frame.size());
+						}
+						instance.transform = layer.transform;
+						instance.color = layer.color;
+						layer.state.reset();
+						layer.frame_duration = 0_i;
+					}
+					++layer.frame_duration;
+					if (layer.state.has() && !layer.state.get()) {
+						layer_iterator = model.erase(layer_iterator);
+					}
+					else {
+						++layer_iterator;
+					}
+				}
+			}
+			for (auto & [layer_index, layer] : model) {
+				auto & frame_list = layer_frame_list[layer_index];
+				if (!frame_list.empty()) {
+					frame_list.last().duration = layer.frame_duration;
+				}
+			}
+			auto item_name = !index.has() ? ("main_sprite"_s) : ("sprite/sprite_{}"_sf(index.get() + 1_sz));
+			auto timeline_name = !index.has() ? ("main_sprite"_s) : ("sprite_{}"_sf(index.get() + 1_sz));
+			open_symbol_document(writer, item_name, timeline_name);
+			for (auto layer_iterator = layer_frame_list.rbegin(); layer_iterator != layer_frame_list.rend(); ++layer_iterator) {
+				writer.open_element("DOMLayer"_sv);
+				writer.push_attribute("name"_sv, "{}"_sf(layer_iterator->first + 1_i));
+				writer.open_element("frames"_sv);
+				for (auto & frame_model : layer_iterator->second) {
+					open_frame_element(writer, frame_model.index, make_optional_of(cbw<Size>(frame_model.duration)));
+					if (frame_model.instance.has()) {
+						auto & instance = frame_model.instance.get();
+						writer.open_element("DOMSymbolInstance"_sv);
+						writer.push_attribute("libraryItemName"_sv, instance.name);
+						writer.push_attribute("symbolType"_sv, "graphic"_sv);
+						writer.push_attribute("loop"_sv, "loop"_sv);
+						if (instance.first_frame.has()) {
+							writer.push_attribute("firstFrame"_sv, "{}"_sf(instance.first_frame.get()));
+						}
+						write_matrix_element(writer, instance.transform);
+						write_color_element(writer, instance.color);
+						writer.close_element();
+					}
+					close_frame_element(writer);
+				}
+				writer.close_element();
+				writer.close_element();
+			}
+			{
+				writer.open_element("DOMLayer"_sv);
+				writer.push_attribute("name"_sv, "0"_sv);
+				writer.open_element("frames"_sv);
+				write_frame_element(writer, k_begin_index, make_optional_of(sprite.frame.size()));
+				writer.close_element();
+				writer.close_element();
+			}
+			close_symbol_document(writer);
+			if constexpr (check_version(version, {1, 4})) {
+				extra.name = ""_s;
+				extra.frame_rate = 0.0_f;
+			}
+			if constexpr (check_version(version, {4})) {
+				extra.name = sprite.name;
+				extra.frame_rate = sprite.frame_rate;
+			}
+			if constexpr (check_version(version, {1, 5})) {
+				extra.work_area.reset();
+			}
+			if constexpr (check_version(version, {5})) {
+				if (sprite.work_area.start == 0_i && sprite.work_area.duration == cbw<Integer>(sprite.frame.size()) - 1_i) {
+					extra.work_area.reset();
+				}
+				else {
+					auto & work_area = extra.work_area.set();
+					work_area.start = sprite.work_area.start;
+					work_area.duration = sprite.work_area.duration;
+				}
+			}
+			return;
+		}
+
+		// NOTE
+		// the label and stop of the main sprite is placed in the flow layer, and the command is placed in the command layer
+		// the main sprite is null only since version 4, in that case every layer is empty
+		static auto process_main (
+			XMLWriter &                                 writer,
+			typename Definition::Animation const &      animation,
+			ZPointer<typename Definition::Sprite const> main_sprite
+		) -> Void {
+			writer.open_element("DOMDocument"_sv);
+			push_xmlns_attribute(writer);
+			writer.push_attribute("frameRate"_sv, "{}"_sf(animation.frame_rate));
+			writer.push_attribute("width"_sv, "{}"_sf(animation.size.width));
+			writer.push_attribute("height"_sv, "{}"_sf(animation.size.height));
+			writer.push_attribute("xflVersion"_sv, k_xfl_version);
+			{
+				writer.open_element("folders"_sv);
+				for (auto & folder_name : {"media"_sv, "source"_sv, "image"_sv, "sprite"_sv}) {
+					writer.open_element("DOMFolderItem"_sv);
+					writer.push_attribute("name"_sv, folder_name);
+					writer.push_attribute("isExpanded"_sv, "false"_sv);
+					writer.close_element();
+				}
+				writer.close_element();
+			}
+			{
+				writer.open_element("media"_sv);
+				for (auto & image : animation.image) {
+					auto media_name = parse_image_file_name(image.name);
+					writer.open_element("DOMBitmapItem"_sv);
+					writer.push_attribute("name"_sv, "media/{}"_sf(media_name));
+					writer.push_attribute("href"_sv, "media/{}.png"_sf(media_name));
+					writer.close_element();
+				}
+				writer.close_element();
+			}
+			{
+				auto write_include_element =
+					[&] (
+					String const & href
+				) -> Void {
+					writer.open_element("Include"_sv);
+					writer.push_attribute("href"_sv, href);
+					writer.close_element();
+					return;
+				};
+				writer.open_element("symbols"_sv);
+				for (auto index : SizeRange{animation.image.size()}) {
+					write_include_element("source/source_{}.xml"_sf(index + 1_sz));
+				}
+				for (auto index : SizeRange{animation.image.size()}) {
+					write_include_element("image/image_{}.xml"_sf(index + 1_sz));
+				}
+				for (auto index : SizeRange{animation.sprite.size()}) {
+					write_include_element("sprite/sprite_{}.xml"_sf(index + 1_sz));
+				}
+				write_include_element("main_sprite.xml"_s);
+				writer.close_element();
+			}
+			writer.open_element("timelines"_sv);
+			writer.open_element("DOMTimeline"_sv);
+			writer.push_attribute("name"_sv, "animation"_sv);
+			writer.open_element("layers"_sv);
+			auto frame_count = main_sprite == nullptr ? (k_none_size) : (main_sprite->frame.size());
+			{
+				writer.open_element("DOMLayer"_sv);
+				writer.push_attribute("name"_sv, "flow"_sv);
+				writer.open_element("frames"_sv);
+				// NOTE : index of the first frame that not covered by the layer yet
+				auto flow_end = k_begin_index;
+				for (auto frame_index : SizeRange{frame_count}) {
+					auto & frame = main_sprite->frame[frame_index];
+					if (!frame.label.has() && !frame.stop) {
+						continue;
+					}
+					if (flow_end < frame_index) {
+						write_frame_element(writer, flow_end, make_optional_of(frame_index - flow_end));
+					}
+					writer.open_element("DOMFrame"_sv);
+					writer.push_attribute("index"_sv, "{}"_sf(frame_index));
+					if (frame.label.has()) {
+						writer.push_attribute("name"_sv, frame.label.get());
+						writer.push_attribute("labelType"_sv, "name"_sv);
+					}
+					if (frame.stop) {
+						writer.open_element("Actionscript"_sv);
+						writer.open_element("script"_sv);
+						writer.push_text("stop();"_sv, k_true);
+						writer.close_element();
+						writer.close_element();
+					}
+					writer.open_element("elements"_sv);
+					writer.close_element();
+					writer.close_element();
+					flow_end = frame_index + 1_sz;
+				}
+				if (flow_end < frame_count) {
+					write_frame_element(writer, flow_end, make_optional_of(frame_count - flow_end));
+				}
+				writer.close_element();
+				writer.close_element();
+			}
+			{
+				writer.open_element("DOMLayer"_sv);
+				writer.push_attribute("name"_sv, "command"_sv);
+				writer.open_element("frames"_sv);
+				auto command_end = k_begin_index;
+				auto script = String{};
+				for (auto frame_index : SizeRange{frame_count}) {
+					auto & frame = main_sprite->frame[frame_index];
+					if (frame.command.empty()) {
+						continue;
+					}
+					if (command_end < frame_index) {
+						write_frame_element(writer, command_end, make_optional_of(frame_index - command_end));
+					}
+					script.set_size(k_none_size);
+					for (auto & command : frame.command) {
+						if (&command != &frame.command.first()) {
+							script.append('\n'_c);
+						}
+						script.append_list(R"(fscommand("{}", "{}");)"_sf(command.command, command.argument));
+					}
+					writer.open_element("DOMFrame"_sv);
+					writer.push_attribute("index"_sv, "{}"_sf(frame_index));
+					writer.open_element("Actionscript"_sv);
+					writer.open_element("script"_sv);
+					writer.push_text(script, k_true);
+					writer.close_element();
+					writer.close_element();
+					writer.open_element("elements"_sv);
+					writer.close_element();
+					writer.close_element();
+					command_end = frame_index + 1_sz;
+				}
+				if (command_end < frame_count) {
+					write_frame_element(writer, command_end, make_optional_of(frame_count - command_end));
+				}
+				writer.close_element();
+				writer.close_element();
+			}
+			{
+				writer.open_element("DOMLayer"_sv);
+				writer.push_attribute("name"_sv, "instance"_sv);
+				writer.open_element("frames"_sv);
+				if (main_sprite != nullptr) {
+					open_frame_element(writer, k_begin_index, make_optional_of(frame_count));
+					writer.open_element("DOMSymbolInstance"_sv);
+					writer.push_attribute("libraryItemName"_sv, "main_sprite"_sv);
+					writer.push_attribute("symbolType"_sv, "graphic"_sv);
+					writer.push_attribute("loop"_sv, "loop"_sv);
+					writer.close_element();
+					close_frame_element(writer);
+				}
+				writer.close_element();
+				writer.close_element();
+			}
+			writer.close_element();
+			writer.close_element();
+			writer.close_element();
+			writer.close_element();
+			return;
+		}
+
+		// ----------------
+
+		static auto process_whole (
+			typename Definition::Animation const & animation,
+			ExtraInformation &                     extra,
+			Path const &                           directory
+		) -> Void {
+			extra.position = animation.position;
+			extra.image.allocate_full(animation.image.size());
+			for (auto index : SizeRange{animation.image.size()}) {
+				write_document(
+					directory / "LIBRARY"_s / "image"_s / "image_{}.xml"_sf(index + 1_sz),
+					[&] (
+						XMLWriter & writer
+					) -> Void {
+						return process_image(writer, extra.image[index], animation.image[index], index);
+					}
+				);
+			}
+			extra.sprite.allocate_full(animation.sprite.size());
+			for (auto index : SizeRange{animation.sprite.size()}) {
+				write_document(
+					directory / "LIBRARY"_s / "sprite"_s / "sprite_{}.xml"_sf(index + 1_sz),
+					[&] (
+						XMLWriter & writer
+					) -> Void {
+						return process_sprite(writer, extra.sprite[index], animation.sprite[index], make_optional_of(index), animation.sprite);
+					}
+				);
+			}
+			auto main_sprite = ZPointer<typename Definition::Sprite const>{nullptr};
+			if constexpr (check_version(version, {1, 4})) {
+				main_sprite = &animation.main_sprite;
+			}
+			if constexpr (check_version(version, {4})) {
+				if (animation.main_sprite.has()) {
+					main_sprite = &animation.main_sprite.get();
+				}
+			}
+			if (main_sprite == nullptr) {
+				extra.main_sprite.reset();
+			}
+			else {
+				write_document(
+					directory / "LIBRARY"_s / "main_sprite.xml"_s,
+					[&] (
+						XMLWriter & writer
+					) -> Void {
+						return process_sprite(writer, extra.main_sprite.set(), *main_sprite, k_null_optional, animation.sprite);
+					}
+				);
+			}
+			write_document(
+				directory / "DOMDocument.xml"_s,
+				[&] (
+					XMLWriter & writer
+				) -> Void {
+					return process_main(writer, animation, main_sprite);
+				}
+			);
+			return;
+		}
+
+		// ----------------
+
+		static auto process (
+			typename Definition::Animation const & animation,
+			ExtraInformation &                     extra,
+			Path const &                           directory
+		) -> Void {
+			restruct(extra);
+			return process_whole(animation, extra, directory);
+		}
+
+	};
+
+}
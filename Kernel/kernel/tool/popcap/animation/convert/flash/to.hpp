@@ -0,0 +1,697 @@
+#pragma once
+
+#include "kernel/utility/utility.hpp"
+#include "kernel/tool/popcap/animation/convert/flash/common.hpp"
+
+namespace TwinStar::Kernel::Tool::PopCap::Animation::Convert::Flash {
+
+	template <auto version> requires (check_version(version, {}))
+	struct To :
+		Common<version> {
+
+		using Common = Common<version>;
+
+		using typename Common::Definition;
+
+		using typename Common::StandardTransform;
+
+		using typename Common::Color;
+
+		using typename Common::XMLReader;
+
+		using typename Common::XMLAttribute;
+
+		using Common::make_initial_transform;
+
+		using Common::make_initial_color;
+
+		using Common::convert_transform_from_standard_to_rotate;
+
+		using Common::convert_transform_from_standard_to_variant;
+
+		using Common::parse_integer;
+
+		using Common::parse_floater;
+
+		using Common::find_attribute;
+
+		using Common::find_attribute_or;
+
+		using Common::get_attribute;
+
+		using Common::read_child_element;
+
+		using Common::read_child_element_unique_or_none;
+
+		using Common::read_child_element_unique;
+
+		using Common::read_child_text;
+
+		using Common::read_document;
+
+		// ----------------
+
+		struct LayerModel {
+			Integer index;
+			Integer resource;
+			Boolean sprite;
+			Integer frame_start;
+			Integer frame_duration;
+			Color   color;
+		};
+
+		struct InstanceModel {
+			String                      name;
+			Optional<StandardTransform> transform;
+			Optional<Color>             color;
+		};
+
+		// NOTE : element_count is the count of child element of the elements node, or none if the frame has no elements node
+		struct FrameModel {
+			Integer                 index;
+			Integer                 duration;
+			Optional<Size>          element_count;
+			Optional<InstanceModel> instance;
+		};
+
+		// ----------------
+
+		static auto parse_transform (
+			XMLAttribute const & x_Matrix
+		) -> StandardTransform {
+			auto result = StandardTransform{};
+			result.a = parse_floater(find_attribute_or(x_Matrix, "a"_sv, "1"_sv));
+			result.b = parse_floater(find_attribute_or(x_Matrix, "b"_sv, "0"_sv));
+			result.c = parse_floater(find_attribute_or(x_Matrix, "c"_sv, "0"_sv));
+			result.d = parse_floater(find_attribute_or(x_Matrix, "d"_sv, "1"_sv));
+			result.x = parse_floater(find_attribute_or(x_Matrix, "tx"_sv, "0"_sv));
+			result.y = parse_floater(find_attribute_or(x_Matrix, "ty"_sv, "0"_sv));
+			return result;
+		}
+
+		// NOTE : the offset part is merged into the multiplier, the result is clamped into [0, 1]
+		static auto parse_color (
+			XMLAttribute const & x_Color
+		) -> Color {
+			auto compute =
+				[&] (
+				CStringView const & multiplier_name,
+				CStringView const & offset_name
+			) -> Floater {
+				auto multiplier = parse_floater(find_attribute_or(x_Color, multiplier_name, "1"_sv));
+				auto offset = parse_floater(find_attribute_or(x_Color, offset_name, "0"_sv));
+				return maximum(0.0_f, minimum(255.0_f, multiplier * 255.0_f + offset)) / 255.0_f;
+			};
+			auto result = Color{};
+			result.red = compute("redMultiplier"_sv, "redOffset"_sv);
+			result.green = compute("greenMultiplier"_sv, "greenOffset"_sv);
+			result.blue = compute("blueMultiplier"_sv, "blueOffset"_sv);
+			result.alpha = compute("alphaMultiplier"_sv, "alphaOffset"_sv);
+			return result;
+		}
+
+		static auto trim_string (
+			CStringView const & string
+		) -> CStringView {
+			auto is_space = [] (Character const & character) -> Boolean {
+				return mbw<Boolean>(character == ' '_c || character == '\t'_c || character == '\r'_c || character == '\n'_c);
+			};
+			auto begin = k_begin_index;
+			auto end = string.size();
+			while (begin < end && is_space(string[begin])) {
+				++begin;
+			}
+			while (begin < end && is_space(string[end - 1_sz])) {
+				--end;
+			}
+			return string.sub(begin, end - begin);
+		}
+
+		// ----------------
+
+		// NOTE : the script text of DOMFrame > Actionscript > script, or none if the frame has no script
+		static auto read_frame_script (
+			XMLReader & reader
+		) -> Optional<String> {
+			auto result = Optional<String>{};
+			read_child_element_unique_or_none(
+				reader,
+				"Actionscript"_sv,
+				[&] (
+					XMLAttribute const & x_Actionscript
+				) -> Void {
+					read_child_element_unique(
+						reader,
+						"script"_sv,
+						[&] (
+							XMLAttribute const & x_script
+						) -> Void {
+							result.set(read_child_text(reader));
+							return;
+						}
+					);
+					return;
+				}
+			);
+			return result;
+		}
+
+		// NOTE : DOMFrame > elements > DOMSymbolInstance, at most one instance is allowed
+		static auto read_frame_element (
+			XMLReader &          reader,
+			XMLAttribute const & x_DOMFrame
+		) -> FrameModel {
+			auto result = FrameModel{};
+			result.index = parse_integer(get_attribute(x_DOMFrame, "index"_sv));
+			result.duration = parse_integer(find_attribute_or(x_DOMFrame, "duration"_sv, "1"_sv));
+			read_child_element_unique_or_none(
+				reader,
+				"elements"_sv,
+				[&] (
+					XMLAttribute const & x_elements
+				) -> Void {
+					auto & element_count = result.element_count.set(k_none_size);
+					read_child_element(
+						reader,
+						[&] (
+							CStringView const &  name,
+							XMLAttribute const & x_DOMSymbolInstance
+						) -> Void {
+							++element_count;
+							if (name != "DOMSymbolInstance"_sv) {
+								return;
+							}
+							assert_test(!result.instance.has());
+							auto & instance = result.instance.set();
+							instance.name = get_attribute(x_DOMSymbolInstance, "libraryItemName"_sv);
+							read_child_element(
+								reader,
+								[&] (
+									CStringView const &  child_name,
+									XMLAttribute const & attribute
+								) -> Void {
+									if (child_name == "matrix"_sv) {
+										assert_test(!instance.transform.has());
+										read_child_element_unique(
+											reader,
+											"Matrix"_sv,
+											[&] (
+												XMLAttribute const & x_Matrix
+											) -> Void {
+												instance.transform.set(parse_transform(x_Matrix));
+												return;
+											}
+										);
+									}
+									if (child_name == "color"_sv) {
+										assert_test(!instance.color.has());
+										read_child_element_unique(
+											reader,
+											"Color"_sv,
+											[&] (
+												XMLAttribute const & x_Color
+											) -> Void {
+												instance.color.set(parse_color(x_Color));
+												return;
+											}
+										);
+									}
+									return;
+								}
+							);
+							return;
+						}
+					);
+					return;
+				}
+			);
+			return result;
+		}
+
+		// NOTE : DOMSymbolItem > timeline > DOMTimeline > layers > DOMLayer > frames > DOMFrame, the frames of every DOMLayer is returned in the order of document
+		static auto read_symbol_document (
+			Path const &        path,
+			CStringView const & item_name,
+			CStringView const & timeline_name
+		) -> List<List<FrameModel>> {
+			auto result = List<List<FrameModel>>{};
+			read_document(
+				path,
+				"DOMSymbolItem"_sv,
+				[&] (
+					XMLReader &          reader,
+					XMLAttribute const & x_DOMSymbolItem
+				) -> Void {
+					assert_test(get_attribute(x_DOMSymbolItem, "name"_sv) == item_name);
+					read_child_element_unique(
+						reader,
+						"timeline"_sv,
+						[&] (
+							XMLAttribute const & x_timeline
+						) -> Void {
+							read_child_element_unique(
+								reader,
+								"DOMTimeline"_sv,
+								[&] (
+									XMLAttribute const & x_DOMTimeline
+								) -> Void {
+									assert_test(get_attribute(x_DOMTimeline, "name"_sv) == timeline_name);
+									read_child_element_unique(
+										reader,
+										"layers"_sv,
+										[&] (
+											XMLAttribute const & x_layers
+										) -> Void {
+											read_child_element(
+												reader,
+												[&] (
+													CStringView const &  name,
+													XMLAttribute const & x_DOMLayer
+												) -> Void {
+													if (name != "DOMLayer"_sv) {
+														return;
+													}
+													auto & frame_list = result.append();
+													read_child_element_unique(
+														reader,
+														"frames"_sv,
+														[&] (
+															XMLAttribute const & x_frames
+														) -> Void {
+															read_child_element(
+																reader,
+																[&] (
+																	CStringView const &  child_name,
+																	XMLAttribute const & x_DOMFrame
+																) -> Void {
+																	if (child_name == "DOMFrame"_sv) {
+																		frame_list.append(read_frame_element(reader, x_DOMFrame));
+																	}
+																	return;
+																}
+															);
+															return;
+														}
+													);
+													return;
+												}
+											);
+											return;
+										}
+									);
+									return;
+								}
+							);
+							return;
+						}
+					);
+					return;
+				}
+			);
+			return result;
+		}
+
+		// ----------------
+
+		static auto process_image (
+			List<List<FrameModel>> const & layer_list,
+			ImageExtraInformation const &  extra,
+			typename Definition::Image &   image,
+			Size const &                   index
+		) -> Void {
+			assert_test(layer_list.size() == 1_sz && layer_list.first().size() == 1_sz);
+			auto & frame_model = layer_list.first().first();
+			assert_test(frame_model.instance.has());
+			auto & instance = frame_model.instance.get();
+			assert_test(instance.name == "source/source_{}"_sf(index + 1_sz));
+			auto transform = !instance.transform.has() ? (make_initial_transform()) : (instance.transform.get());
+			image.name = extra.name;
+			if constexpr (check_version(version, {4})) {
+				image.size = extra.size;
+			}
+			if constexpr (check_version(version, {1, 2})) {
+				convert_transform_from_standard_to_rotate(transform, image.transform);
+			}
+			if constexpr (check_version(version, {2})) {
+				image.transform = transform;
+			}
+			return;
+		}
+
+		// NOTE
+		// the last DOMLayer is the placeholder layer that decide the frame count, the others are read from bottom to top
+		// a DOMFrame without elements end the current layer, a layer with a different instance is not allowed
+		static auto process_sprite (
+			List<List<FrameModel>> const & layer_list,
+			SpriteExtraInformation const & extra,
+			typename Definition::Sprite &  sprite
+		) -> Void {
+			assert_test(!layer_list.empty());
+			auto & frame_list = sprite.frame;
+			{
+				assert_test(layer_list.last().size() == 1_sz);
+				auto & frame_model = layer_list.last().first();
+				assert_test(frame_model.index == 0_i && frame_model.duration > 0_i);
+				assert_test(frame_model.element_count.has() && frame_model.element_count.get() == k_none_size);
+				// NOTE : an extra frame to hold the remove of the layer that last until the end
+				frame_list.allocate_full(cbw<Size>(frame_model.duration) + 1_sz);
+			}
+			auto layer_count = 0_i;
+			auto model = Optional<LayerModel>{};
+			auto close_current_model_if_need =
+				[&] (
+			) -> Void {
+				if (model.has()) {
+					auto & target_frame = frame_list[cbw<Size>(model.get().frame_start + model.get().frame_duration)];
+					auto & remove = target_frame.remove.append();
+					remove.index = model.get().index;
+					model.reset();
+				}
+				return;
+			};
+			for (auto & layer : make_reverse_range_of(layer_list.head(layer_list.size() - 1_sz))) {
+				for (auto & frame_model : layer) {
+					if (!frame_model.element_count.has()) {
+						close_current_model_if_need();
+						continue;
+					}
+					if (!frame_model.instance.has()) {
+						continue;
+					}
+					auto & instance = frame_model.instance.get();
+					auto resource = Integer{};
+					auto is_sprite = Boolean{};
+					if (instance.name.size() > "image/image_"_sl && instance.name.head("image/image_"_sl) == "image/image_"_sv) {
+						resource = parse_integer(instance.name.tail(instance.name.size() - "image/image_"_sl)) - 1_i;
+						is_sprite = k_false;
+					}
+					else if (instance.name.size() > "sprite/sprite_"_sl && instance.name.head("sprite/sprite_"_sl) == "sprite/sprite_"_sv) {
+						resource = parse_integer(instance.name.tail(instance.name.size() - "sprite/sprite_"_sl)) - 1_i;
+						is_sprite = k_true;
+					}
+					else {
+						assert_fail(R"(/* library item name is valid */)");
+					}
+					auto transform = typename Definition::VariantTransform{};
+					if (instance.transform.has()) {
+						convert_transform_from_standard_to_variant(instance.transform.get(), transform);
+					}
+					else {
+						auto & transform_value = transform.template set<typename Definition::TranslateTransform>();
+						transform_value.x = 0.0_f;
+						transform_value.y = 0.0_f;
+					}
+					auto color = !instance.color.has() ? (make_initial_color()) : (instance.color.get());
+					assert_test(Math::between(frame_model.index, 0_i, cbw<Integer>(frame_list.size()) - 1_i));
+					auto & target_frame = frame_list[cbw<Size>(frame_model.index)];
+					if (!model.has()) {
+						model.set(
+							LayerModel{
+								.index = layer_count,
+								.resource = resource,
+								.sprite = is_sprite,
+								.frame_start = frame_model.index,
+								.frame_duration = frame_model.duration,
+								.color = make_initial_color(),
+							}
+						);
+						auto & append = target_frame.append.append();
+						append.index = model.get().index;
+						append.name.reset();
+						append.resource = resource;
+						append.sprite = is_sprite;
+						append.additive = k_false;
+						append.preload_frame = 0_i;
+						append.time_scale = 1.0_f;
+						++layer_count;
+					}
+					else {
+						assert_test(model.get().resource == resource && model.get().sprite == is_sprite);
+					}
+					model.get().frame_start = frame_model.index;
+					model.get().frame_duration = frame_model.duration;
+					auto & change = target_frame.change.append();
+					change.index = model.get().index;
+					change.transform = transform;
+					if (model.get().color == color) {
+						change.color.reset();
+					}
+					else {
+						model.get().color = color;
+						change.color.set(color);
+					}
+					change.sprite_frame_number.reset();
+					change.source_rectangle.reset();
+				}
+				close_current_model_if_need();
+			}
+			frame_list.set_size(frame_list.size() - 1_sz);
+			frame_list.shrink_to_fit();
+			if constexpr (check_version(version, {4})) {
+				sprite.name = extra.name;
+				sprite.frame_rate = extra.frame_rate;
+			}
+			if constexpr (check_version(version, {5})) {
+				if (!extra.work_area.has()) {
+					sprite.work_area.start = 0_i;
+					sprite.work_area.duration = cbw<Integer>(frame_list.size()) - 1_i;
+				}
+				else {
+					sprite.work_area.start = extra.work_area.get().start;
+					sprite.work_area.duration = extra.work_area.get().duration;
+				}
+			}
+			return;
+		}
+
+		// NOTE : the label and stop is read from the flow layer, and the command is read from the command layer
+		static auto process_main (
+			XMLReader &                           reader,
+			XMLAttribute const &                  x_DOMDocument,
+			typename Definition::Animation &      animation,
+			ZPointer<typename Definition::Sprite> main_sprite
+		) -> Void {
+			animation.frame_rate = parse_integer(find_attribute_or(x_DOMDocument, "frameRate"_sv, "24"_sv));
+			animation.size.width = parse_floater(get_attribute(x_DOMDocument, "width"_sv));
+			animation.size.height = parse_floater(get_attribute(x_DOMDocument, "height"_sv));
+			if (main_sprite == nullptr) {
+				return;
+			}
+			auto & frame_list = main_sprite->frame;
+			auto get_frame =
+				[&] (
+				XMLAttribute const & x_DOMFrame
+			) -> typename Definition::Frame & {
+				auto frame_index = parse_integer(get_attribute(x_DOMFrame, "index"_sv));
+				assert_test(Math::between(frame_index, 0_i, cbw<Integer>(frame_list.size()) - 1_i));
+				return frame_list[cbw<Size>(frame_index)];
+			};
+			auto process_flow_frame =
+				[&] (
+				XMLAttribute const & x_DOMFrame
+			) -> Void {
+				auto & frame = get_frame(x_DOMFrame);
+				auto label = find_attribute(x_DOMFrame, "name"_sv);
+				if (label.has()) {
+					assert_test(get_attribute(x_DOMFrame, "labelType"_sv) == "name"_sv);
+					frame.label.set(label.get());
+				}
+				auto script = read_frame_script(reader);
+				if (script.has()) {
+					assert_test(trim_string(script.get()) == "stop();"_sv);
+					frame.stop = k_true;
+				}
+				return;
+			};
+			auto process_command_frame =
+				[&] (
+				XMLAttribute const & x_DOMFrame
+			) -> Void {
+				auto & frame = get_frame(x_DOMFrame);
+				auto script = read_frame_script(reader);
+				if (!script.has()) {
+					return;
+				}
+				auto script_text = trim_string(script.get());
+				for (auto line_begin = k_begin_index; line_begin <= script_text.size();) {
+					auto line_size = Range::find_index(script_text.tail(script_text.size() - line_begin), '\n'_c);
+					auto line_end = line_size.has() ? (line_begin + line_size.get()) : (script_text.size());
+					auto line = trim_string(script_text.sub(line_begin, line_end - line_begin));
+					// NOTE : fscommand("<command>", "<argument>");
+					assert_test(line.size() >= R"(fscommand("", "");)"_sl);
+					assert_test(line.head(R"(fscommand(")"_sl) == R"(fscommand(")"_sv && line.tail(R"(");)"_sl) == R"(");)"_sv);
+					auto content = line.sub(R"(fscommand(")"_sl, line.size() - R"(fscommand(")"_sl - R"(");)"_sl);
+					auto separator = Optional<Size>{};
+					for (auto index : SizeRange{content.size()}) {
+						if (content.size() - index >= R"(", ")"_sl && content.sub(index, R"(", ")"_sl) == R"(", ")"_sv) {
+							separator.set(index);
+						}
+					}
+					assert_test(separator.has());
+					auto & command = frame.command.append();
+					command.command = content.head(separator.get());
+					command.argument = content.tail(content.size() - separator.get() - R"(", ")"_sl);
+					line_begin = line_end + 1_sz;
+				}
+				return;
+			};
+			auto process_instance_frame =
+				[&] (
+				XMLAttribute const & x_DOMFrame
+			) -> Void {
+				auto frame_model = read_frame_element(reader, x_DOMFrame);
+				assert_test(frame_model.instance.has() && frame_model.instance.get().name == "main_sprite"_sv);
+				return;
+			};
+			read_child_element_unique(
+				reader,
+				"timelines"_sv,
+				[&] (
+					XMLAttribute const & x_timelines
+				) -> Void {
+					read_child_element_unique(
+						reader,
+						"DOMTimeline"_sv,
+						[&] (
+							XMLAttribute const & x_DOMTimeline
+						) -> Void {
+							assert_test(get_attribute(x_DOMTimeline, "name"_sv) == "animation"_sv);
+							read_child_element_unique(
+								reader,
+								"layers"_sv,
+								[&] (
+									XMLAttribute const & x_layers
+								) -> Void {
+									auto layer_count = k_none_size;
+									read_child_element(
+										reader,
+										[&] (
+											CStringView const &  name,
+											XMLAttribute const & x_DOMLayer
+										) -> Void {
+											if (name != "DOMLayer"_sv) {
+												return;
+											}
+											++layer_count;
+											auto layer_name = String{get_attribute(x_DOMLayer, "name"_sv)};
+											read_child_element_unique(
+												reader,
+												"frames"_sv,
+												[&] (
+													XMLAttribute const & x_frames
+												) -> Void {
+													if (layer_count == 1_sz) {
+														assert_test(layer_name == "flow"_sv);
+														read_child_element(
+															reader,
+															[&] (
+																CStringView const &  child_name,
+																XMLAttribute const & x_DOMFrame
+															) -> Void {
+																if (child_name == "DOMFrame"_sv) {
+																	process_flow_frame(x_DOMFrame);
+																}
+																return;
+															}
+														);
+													}
+													if (layer_count == 2_sz) {
+														assert_test(layer_name == "command"_sv);
+														read_child_element(
+															reader,
+															[&] (
+																CStringView const &  child_name,
+																XMLAttribute const & x_DOMFrame
+															) -> Void {
+																if (child_name == "DOMFrame"_sv) {
+																	process_command_frame(x_DOMFrame);
+																}
+																return;
+															}
+														);
+													}
+													if (layer_count == 3_sz) {
+														assert_test(layer_name == "instance"_sv);
+														read_child_element_unique(reader, "DOMFrame"_sv, process_instance_frame);
+													}
+													return;
+												}
+											);
+											return;
+										}
+									);
+									assert_test(layer_count == 3_sz);
+									return;
+								}
+							);
+							return;
+						}
+					);
+					return;
+				}
+			);
+			return;
+		}
+
+		// ----------------
+
+		static auto process_whole (
+			typename Definition::Animation & animation,
+			ExtraInformation const &         extra,
+			Path const &                     directory
+		) -> Void {
+			animation.position = extra.position;
+			animation.image.allocate_full(extra.image.size());
+			for (auto index : SizeRange{extra.image.size()}) {
+				auto layer_list = read_symbol_document(directory / "LIBRARY"_s / "image"_s / "image_{}.xml"_sf(index + 1_sz), "image/image_{}"_sf(index + 1_sz), "image_{}"_sf(index + 1_sz));
+				process_image(layer_list, extra.image[index], animation.image[index], index);
+			}
+			animation.sprite.allocate_full(extra.sprite.size());
+			for (auto index : SizeRange{extra.sprite.size()}) {
+				auto layer_list = read_symbol_document(directory / "LIBRARY"_s / "sprite"_s / "sprite_{}.xml"_sf(index + 1_sz), "sprite/sprite_{}"_sf(index + 1_sz), "sprite_{}"_sf(index + 1_sz));
+				process_sprite(layer_list, extra.sprite[index], animation.sprite[index]);
+			}
+			auto main_sprite = ZPointer<typename Definition::Sprite>{nullptr};
+			if constexpr (check_version(version, {1, 4})) {
+				assert_test(extra.main_sprite.has());
+				main_sprite = &animation.main_sprite;
+			}
+			if constexpr (check_version(version, {4})) {
+				if (extra.main_sprite.has()) {
+					main_sprite = &animation.main_sprite.set();
+				}
+				else {
+					animation.main_sprite.reset();
+				}
+			}
+			if (main_sprite != nullptr) {
+				auto layer_list = read_symbol_document(directory / "LIBRARY"_s / "main_sprite.xml"_s, "main_sprite"_sv, "main_sprite"_sv);
+				process_sprite(layer_list, extra.main_sprite.get(), *main_sprite);
+			}
+			read_document(
+				directory / "DOMDocument.xml"_s,
+				"DOMDocument"_sv,
+				[&] (
+					XMLReader &          reader,
+					XMLAttribute const & x_DOMDocument
+				) -> Void {
+					return process_main(reader, x_DOMDocument, animation, main_sprite);
+				}
+			);
+			return;
+		}
+
+		// ----------------
+
+		static auto process (
+			typename Definition::Animation & animation,
+			ExtraInformation const &         extra,
+			Path const &                     directory
+		) -> Void {
+			restruct(animation);
+			return process_whole(animation, extra, directory);
+		}
+
+	};
+
+}
@@ -2,6 +2,7 @@
 
 #include "kernel/utility/utility.hpp"
 #include "kernel/tool/popcap/crypt_data/common.hpp"
+#include "kernel/tool/data/encryption/xor/encrypt.hpp"
 
 namespace TwinStar::Kernel::Tool::PopCap::CryptData {
 
@@ -3,6 +3,7 @@
 #include "kernel/utility/utility.hpp"
 #include "kernel/tool/popcap/package/common.hpp"
 #include "kernel/tool/data/compression/deflate/uncompress.hpp"
+#include "kernel/tool/data/encryption/xor/encrypt.hpp"
 
 namespace TwinStar::Kernel::Tool::PopCap::Package {
 
@@ -16,52 +17,95 @@ namespace TwinStar::Kernel::Tool::PopCap::Package {
 
 		// ----------------
 
+		// NOTE : flag-less resource information, path is a 8-bit length prefixed string
+		inline static constexpr auto k_resource_information_size_bound = 1_sz + 0xFF_sz + 4_sz + 4_sz + 8_sz;
+
+		// ----------------
+
 		static auto process_package (
 			IByteStreamView &              data,
 			typename Definition::Package & definition,
-			Optional<Path> const &         resource_directory
+			Optional<Path> const &         resource_directory,
+			CByteListView const &          key
 		) -> Void {
-			data.read_constant(Structure::k_magic_identifier);
-			data.read_constant(cbw<Structure::VersionNumber>(version.number));
+			// NOTE : the entry table is decoded through a small window that cover any single entry, instead of a decrypted copy of the whole package
+			auto window = StaticByteArray<k_resource_information_size_bound>{};
+			auto read_window =
+				[&] (
+				Size const & size
+			) -> IByteStreamView {
+				auto window_view = window.view().head(minimum(size, data.reserve()));
+				Data::Encryption::XOR::Encrypt::process_view(data.reserve_view().head(window_view.size()), window_view, key, data.position());
+				return IByteStreamView{window_view};
+			};
+			auto magic_identifier_stream = read_window(bs_static_size<Structure::MagicIdentifier>() + bs_static_size<Structure::VersionNumber>());
+			magic_identifier_stream.read_constant(Structure::k_magic_identifier);
+			magic_identifier_stream.read_constant(cbw<Structure::VersionNumber>(version.number));
+			data.forward(magic_identifier_stream.position());
 			auto information_structure = Structure::Information<version>{};
 			{
 				information_structure.resource_information.allocate(k_none_size);
 				while (k_true) {
-					auto flag = data.read_of<IntegerU8>();
+					auto flag_stream = read_window(bs_static_size<IntegerU8>());
+					auto flag = IntegerU8{};
+					flag_stream.read(flag);
+					data.forward(flag_stream.position());
 					if (flag == Structure::ResourceInformationListStateFlag<version>::done) {
 						break;
 					}
 					if (flag == Structure::ResourceInformationListStateFlag<version>::next) {
 						information_structure.resource_information.append();
-						data.read(information_structure.resource_information.last());
+						auto information_stream = read_window(k_resource_information_size_bound);
+						information_stream.read(information_structure.resource_information.last());
+						data.forward(information_stream.position());
 						continue;
 					}
 					assert_fail(R"(flag == /* valid */)");
 				}
 			}
 			definition.resource.allocate_full(information_structure.resource_information.size());
+			auto resource_data_list = List<CByteListView>{};
+			auto resource_data_position_list = List<Size>{};
+			resource_data_list.allocate_full(information_structure.resource_information.size());
+			resource_data_position_list.allocate_full(information_structure.resource_information.size());
 			for (auto & resource_index : SizeRange{information_structure.resource_information.size()}) {
 				auto & resource_information_structure = information_structure.resource_information[resource_index];
 				auto & resource_definition = definition.resource[resource_index];
 				resource_definition.path = Path{resource_information_structure.path.value};
 				resource_definition.time = cbw<Integer>(resource_information_structure.time);
-				auto resource_data = data.forward_view(cbw<Size>(resource_information_structure.size));
-				if constexpr (check_version(version, {}, {false})) {
-					if (resource_directory.has()) {
-						FileSystem::write_file(resource_directory.get() / resource_definition.path, resource_data);
+				resource_data_position_list[resource_index] = data.position();
+				resource_data_list[resource_index] = data.forward_view(cbw<Size>(resource_information_structure.size));
+			}
+			// NOTE : resource data is decrypted and inflated per resource, concurrently
+			parallel_each(
+				information_structure.resource_information.size(),
+				[&] (Size const & resource_index) {
+					auto & resource_information_structure = information_structure.resource_information[resource_index];
+					auto & resource_definition = definition.resource[resource_index];
+					auto   resource_data = resource_data_list[resource_index];
+					auto   resource_data_plain = ByteArray{};
+					if (key.size() != 0_sz) {
+						resource_data_plain.allocate(resource_data.size());
+						Data::Encryption::XOR::Encrypt::process_view(resource_data, resource_data_plain, key, resource_data_position_list[resource_index]);
+						resource_data = resource_data_plain.view();
 					}
-				}
-				if constexpr (check_version(version, {}, {true})) {
-					auto resource_data_original = ByteArray{cbw<Size>(resource_information_structure.size_original)};
-					auto resource_data_stream = IByteStreamView{resource_data};
-					auto resource_data_original_stream = OByteStreamView{resource_data_original};
-					Data::Compression::Deflate::Uncompress::process(resource_data_stream, resource_data_original_stream, 15_sz, Data::Compression::Deflate::Wrapper::Constant::zlib());
-					assert_test(resource_data_stream.full() && resource_data_original_stream.full());
-					if (resource_directory.has()) {
-						FileSystem::write_file(resource_directory.get() / resource_definition.path, resource_data_original);
+					if constexpr (check_version(version, {}, {false})) {
+						if (resource_directory.has()) {
+							FileSystem::write_file(resource_directory.get() / resource_definition.path, resource_data);
+						}
+					}
+					if constexpr (check_version(version, {}, {true})) {
+						auto resource_data_original = ByteArray{cbw<Size>(resource_information_structure.size_original)};
+						auto resource_data_stream = IByteStreamView{resource_data};
+						auto resource_data_original_stream = OByteStreamView{resource_data_original};
+						Data::Compression::Deflate::Uncompress::process(resource_data_stream, resource_data_original_stream, 15_sz, Data::Compression::Deflate::Wrapper::Constant::zlib());
+						assert_test(resource_data_stream.full() && resource_data_original_stream.full());
+						if (resource_directory.has()) {
+							FileSystem::write_file(resource_directory.get() / resource_definition.path, resource_data_original);
+						}
 					}
 				}
-			}
+			);
 			return;
 		}
 
@@ -70,11 +114,12 @@ namespace TwinStar::Kernel::Tool::PopCap::Package {
 		static auto process (
 			IByteStreamView &              data_,
 			typename Definition::Package & definition,
-			Optional<Path> const &         resource_directory
+			Optional<Path> const &         resource_directory,
+			CByteListView const &          key
 		) -> Void {
 			M_use_zps_of(data);
 			restruct(definition);
-			return process_package(data, definition, resource_directory);
+			return process_package(data, definition, resource_directory, key);
 		}
 
 	};
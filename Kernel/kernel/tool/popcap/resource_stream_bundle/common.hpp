@@ -4,6 +4,7 @@
 #include "kernel/tool/popcap/resource_stream_bundle/version.hpp"
 #include "kernel/tool/popcap/resource_stream_bundle/definition.hpp"
 #include "kernel/tool/popcap/resource_stream_bundle/manifest.hpp"
+#include "kernel/tool/popcap/resource_stream_bundle/index.hpp"
 #include "kernel/tool/popcap/resource_stream_bundle/structure.hpp"
 #include "kernel/tool/popcap/resource_stream_bundle/shared.hpp"
 
@@ -16,6 +17,8 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 
 		using Manifest = Manifest<version>;
 
+		using Index = Index<version>;
+
 		// ----------------
 
 		inline static auto const k_suffix_of_composite_shell_upper = CStringView{"_COMPOSITESHELL"_sv};
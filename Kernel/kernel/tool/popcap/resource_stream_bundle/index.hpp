@@ -0,0 +1,138 @@
+#pragma once
+
+#include "kernel/utility/utility.hpp"
+#include "kernel/tool/popcap/resource_stream_bundle/version.hpp"
+#include "kernel/tool/popcap/resource_stream_bundle/shared.hpp"
+
+namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
+
+	// NOTE : the index is built from information section only, packet data is never touched
+	template <auto version> requires (check_version(version, {}, {}))
+	struct Index {
+
+		#pragma region resource
+
+		template <typename = None>
+		struct TextureResource_;
+
+		using TextureResource = TextureResource_<>;
+
+		template <typename _> requires (check_version(version, {1}, {0, 1}))
+		M_record_of_map(
+			M_wrap(TextureResource_<_>),
+			M_wrap(
+				(Size2<Integer>) size,
+				(Integer) format,
+				(Integer) pitch,
+			),
+		);
+
+		template <typename _> requires (check_version(version, {4}, {1, 2}))
+		M_record_of_map(
+			M_wrap(TextureResource_<_>),
+			M_wrap(
+				(Size2<Integer>) size,
+				(Integer) format,
+				(Integer) pitch,
+				(Integer) additional_byte_count,
+			),
+		);
+
+		template <typename _> requires (check_version(version, {4}, {2}))
+		M_record_of_map(
+			M_wrap(TextureResource_<_>),
+			M_wrap(
+				(Size2<Integer>) size,
+				(Integer) format,
+				(Integer) pitch,
+				(Integer) additional_byte_count,
+				(Integer) scale,
+			),
+		);
+
+		#pragma endregion
+
+		#pragma region group
+
+		template <typename = None>
+		struct SubgroupCategory_;
+
+		using SubgroupCategory = SubgroupCategory_<>;
+
+		template <typename _> requires (check_version(version, {1, 3}, {}))
+		M_record_of_map(
+			M_wrap(SubgroupCategory_<_>),
+			M_wrap(
+				(Optional<Integer>) resolution,
+			),
+		);
+
+		template <typename _> requires (check_version(version, {3}, {}))
+		M_record_of_map(
+			M_wrap(SubgroupCategory_<_>),
+			M_wrap(
+				(Optional<Integer>) resolution,
+				(Optional<String>) locale,
+			),
+		);
+
+		// ----------------
+
+		template <typename = None>
+		struct Subgroup_;
+
+		using Subgroup = Subgroup_<>;
+
+		template <typename _> requires (check_version(version, {1}, {}))
+		M_record_of_map(
+			M_wrap(Subgroup_<_>),
+			M_wrap(
+				(String) id,
+				(SubgroupCategory) category,
+				(PacketCompression) compression,
+				(Integer) offset,
+				(Integer) size,
+				(List<Path>) resource,
+				(List<TextureResource>) texture_resource,
+			),
+		);
+
+		// ----------------
+
+		template <typename = None>
+		struct Group_;
+
+		using Group = Group_<>;
+
+		template <typename _> requires (check_version(version, {1}, {}))
+		M_record_of_map(
+			M_wrap(Group_<_>),
+			M_wrap(
+				(String) id,
+				(Boolean) composite,
+				(List<Subgroup>) subgroup,
+			),
+		);
+
+		#pragma endregion
+
+		#pragma region package
+
+		template <typename = None>
+		struct Package_;
+
+		using Package = Package_<>;
+
+		template <typename _> requires (check_version(version, {1}, {}))
+		M_record_of_map(
+			M_wrap(Package_<_>),
+			M_wrap(
+				(List<Group>) group,
+			),
+		);
+
+		#pragma endregion
+
+	};
+
+}
@@ -39,17 +39,26 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 
 		// ----------------
 
-		static auto process_package_manifest (
-			OByteStreamView &                  data,
-			Structure::Header<version> &       header_structure,
-			typename Manifest::Package const & manifest
+		struct ManifestInformation {
+			List<Structure::GroupManifestInformation<version>>          group;
+			List<Structure::ResourceDetailManifestInformation<version>> resource_detail;
+			List<String>                                                string;
+			Size                                                        string_size;
+		};
+
+		// ----------------
+
+		static auto make_package_manifest (
+			typename Manifest::Package const & manifest,
+			ManifestInformation &              manifest_information
 		) -> Void {
-			auto resource_manifest_information_data_size = k_none_size;
-			auto string_manifest_information_data_size = k_none_size;
-			auto group_manifest_information_structure_list = List<Structure::GroupManifestInformation<version>>{};
-			auto resource_detail_manifest_information_structure_list = List<Structure::ResourceDetailManifestInformation<version>>{};
-			auto string_map = std::unordered_map<String, Size>{};
-			auto string_list = List<String>{};
+			manifest_information.string_size = k_none_size;
+			auto   resource_manifest_information_data_size = k_none_size;
+			auto & string_manifest_information_data_size = manifest_information.string_size;
+			auto & group_manifest_information_structure_list = manifest_information.group;
+			auto & resource_detail_manifest_information_structure_list = manifest_information.resource_detail;
+			auto & string_list = manifest_information.string;
+			auto   string_map = std::unordered_map<String, Size>{};
 			auto set_string =
 				[&] (
 				String const & string
@@ -148,27 +157,159 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 					}
 				}
 			}
+			return;
+		}
+
+		static auto compute_package_manifest_size (
+			ManifestInformation const & manifest_information
+		) -> Size {
+			return bs_size(manifest_information.group) + bs_size(manifest_information.resource_detail) + manifest_information.string_size;
+		}
+
+		static auto process_package_manifest (
+			OByteStreamView &            data,
+			Structure::Header<version> & header_structure,
+			ManifestInformation const &  manifest_information
+		) -> Void {
 			header_structure.group_manifest_information_section_offset = cbw<IntegerU32>(data.position());
-			data.write(group_manifest_information_structure_list);
+			data.write(manifest_information.group);
 			header_structure.resource_manifest_information_section_offset = cbw<IntegerU32>(data.position());
-			data.write(resource_detail_manifest_information_structure_list);
+			data.write(manifest_information.resource_detail);
 			header_structure.string_manifest_information_section_offset = cbw<IntegerU32>(data.position());
-			for (auto & element : string_list) {
+			for (auto & element : manifest_information.string) {
 				StringParser::write_string_until(self_cast<OCharacterStreamView>(data), element, CharacterType::k_null);
 				data.write_constant(CharacterType::k_null);
 			}
 			return;
 		}
 
-		static auto process_package (
+		static auto make_information_structure_for_layout (
+			typename Definition::Package const & definition,
+			Structure::Information<version> &    information_structure
+		) -> Void {
+			auto global_group_count = k_none_size;
+			auto global_subgroup_count = k_none_size;
+			auto global_resource_count = k_none_size;
+			auto global_general_resource_count = k_none_size;
+			auto global_texture_resource_count = k_none_size;
+			global_group_count += definition.group.size();
+			for (auto & group_definition : definition.group) {
+				global_subgroup_count += group_definition.subgroup.size();
+				for (auto & subgroup_definition : group_definition.subgroup) {
+					global_resource_count += subgroup_definition.resource.size();
+					for (auto & resource_definition : subgroup_definition.resource) {
+						switch (resource_definition.additional.type().value) {
+							case ResourceType::Constant::general().value : {
+								++global_general_resource_count;
+								break;
+							}
+							case ResourceType::Constant::texture().value : {
+								++global_texture_resource_count;
+								break;
+							}
+						}
+					}
+				}
+			}
+			information_structure.group_id.allocate_full(global_group_count);
+			information_structure.group_information.allocate_full(global_group_count);
+			information_structure.subgroup_id.allocate_full(global_subgroup_count);
+			information_structure.subgroup_information.allocate_full(global_subgroup_count);
+			information_structure.pool_information.allocate_full(global_subgroup_count);
+			information_structure.resource_path.allocate_full(global_resource_count);
+			information_structure.texture_resource_information.allocate_full(global_texture_resource_count);
+			auto global_group_index = k_begin_index;
+			auto global_subgroup_index = k_begin_index;
+			auto global_resource_index = k_begin_index;
+			auto global_general_resource_index = k_begin_index;
+			auto global_texture_resource_index = k_begin_index;
+			for (auto & group_index : SizeRange{definition.group.size()}) {
+				auto & group_definition = definition.group[group_index];
+				auto & group_id_structure = information_structure.group_id.at(global_group_index);
+				auto   standard_group_id = make_standard_group_id(group_definition.id, group_definition.composite);
+				group_id_structure.key = standard_group_id;
+				for (auto & subgroup_index : SizeRange{group_definition.subgroup.size()}) {
+					auto & subgroup_definition = group_definition.subgroup[subgroup_index];
+					auto & subgroup_id_structure = information_structure.subgroup_id.at(global_subgroup_index);
+					subgroup_id_structure.key = subgroup_definition.id;
+					for (auto & resource_index : SizeRange{subgroup_definition.resource.size()}) {
+						auto & resource_definition = subgroup_definition.resource[resource_index];
+						auto & resource_path_structure = information_structure.resource_path.at(global_resource_index);
+						resource_path_structure.key = resource_definition.path.to_string(CharacterType::PathSeparator::windows);
+						switch (resource_definition.additional.type().value) {
+							case ResourceType::Constant::general().value : {
+								auto & resource_additional_definition = resource_definition.additional.template get_of_type<ResourceType::Constant::general()>();
+								++global_general_resource_index;
+								break;
+							}
+							case ResourceType::Constant::texture().value : {
+								auto & resource_additional_definition = resource_definition.additional.template get_of_type<ResourceType::Constant::texture()>();
+								auto & texture_information_structure = information_structure.texture_resource_information[global_texture_resource_index];
+								++global_texture_resource_index;
+								break;
+							}
+						}
+						++global_resource_index;
+					}
+					++global_subgroup_index;
+				}
+				++global_group_index;
+			}
+			CompiledMapData::adjust_sequence(information_structure.group_id);
+			CompiledMapData::adjust_sequence(information_structure.subgroup_id);
+			CompiledMapData::adjust_sequence(information_structure.resource_path);
+			return;
+		}
+
+		static auto estimate_package_information (
+			typename Definition::Package const &         definition,
+			Optional<typename Manifest::Package> const & manifest,
+			Size &                                       information_section_size_bound
+		) -> Void {
+			auto information_structure = Structure::Information<version>{};
+			make_information_structure_for_layout(definition, information_structure);
+			information_section_size_bound = bs_static_size<Structure::MagicIdentifier>() + bs_static_size<Structure::VersionNumber>();
+			information_section_size_bound += bs_size(information_structure.header);
+			information_section_size_bound += CompiledMapData::compute_ripe_size(information_structure.resource_path);
+			information_section_size_bound += CompiledMapData::compute_ripe_size(information_structure.subgroup_id);
+			information_section_size_bound += bs_size(information_structure.group_information);
+			information_section_size_bound += CompiledMapData::compute_ripe_size(information_structure.group_id);
+			information_section_size_bound += bs_size(information_structure.subgroup_information);
+			information_section_size_bound += bs_size(information_structure.pool_information);
+			information_section_size_bound += bs_size(information_structure.texture_resource_information);
+			if constexpr (check_version(version, {4}, {})) {
+				information_section_size_bound = compute_padded_size(information_section_size_bound, k_padding_unit_size);
+			}
+			if (manifest.has()) {
+				auto manifest_information = ManifestInformation{};
+				make_package_manifest(manifest.get(), manifest_information);
+				information_section_size_bound += compute_package_manifest_size(manifest_information);
+			}
+			information_section_size_bound = compute_padded_size(information_section_size_bound, k_padding_unit_size);
+			return;
+		}
+
+		// ----------------
+
+		// NOTE
+		// data receive the information section, packet_begin(estimator) provide the stream for each packet, packet_end(offset, packet_data) commit it
+		// estimator() return the size bound of the current packet, it is only invoked if the caller need it
+		template <typename PacketBegin, typename PacketEnd> requires
+			CategoryConstraint<IsPureInstance<PacketBegin> && IsPureInstance<PacketEnd>>
+			&& (IsGenericCallable<PacketBegin>)
+			&& (IsGenericCallable<PacketEnd>)
+		static auto process_package_with (
 			OByteStreamView &                            data,
 			typename Definition::Package const &         definition,
 			Optional<typename Manifest::Package> const & manifest,
 			Path const &                                 resource_directory,
 			Optional<Path> const &                       packet_file,
-			Optional<Path> const &                       new_packet_file
+			Optional<Path> const &                       new_packet_file,
+			PacketBegin const &                          packet_begin,
+			PacketEnd const &                            packet_end
 		) -> Void {
 			constexpr auto packet_version = ResourceStreamGroup::Version{.number = version.number};
+			auto span = TraceSpan{"popcap.resource_stream_bundle.pack"_sv};
 			data.write_constant(Structure::k_magic_identifier);
 			data.write_constant(cbw<Structure::VersionNumber>(version.number));
 			struct {
@@ -191,77 +332,7 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 				information_data = {};
 			{
 				auto information_structure = Structure::Information<version>{};
-				auto global_group_count = k_none_size;
-				auto global_subgroup_count = k_none_size;
-				auto global_resource_count = k_none_size;
-				auto global_general_resource_count = k_none_size;
-				auto global_texture_resource_count = k_none_size;
-				global_group_count += definition.group.size();
-				for (auto & group_definition : definition.group) {
-					global_subgroup_count += group_definition.subgroup.size();
-					for (auto & subgroup_definition : group_definition.subgroup) {
-						global_resource_count += subgroup_definition.resource.size();
-						for (auto & resource_definition : subgroup_definition.resource) {
-							switch (resource_definition.additional.type().value) {
-								case ResourceType::Constant::general().value : {
-									++global_general_resource_count;
-									break;
-								}
-								case ResourceType::Constant::texture().value : {
-									++global_texture_resource_count;
-									break;
-								}
-							}
-						}
-					}
-				}
-				information_structure.group_id.allocate_full(global_group_count);
-				information_structure.group_information.allocate_full(global_group_count);
-				information_structure.subgroup_id.allocate_full(global_subgroup_count);
-				information_structure.subgroup_information.allocate_full(global_subgroup_count);
-				information_structure.pool_information.allocate_full(global_subgroup_count);
-				information_structure.resource_path.allocate_full(global_resource_count);
-				information_structure.texture_resource_information.allocate_full(global_texture_resource_count);
-				auto global_group_index = k_begin_index;
-				auto global_subgroup_index = k_begin_index;
-				auto global_resource_index = k_begin_index;
-				auto global_general_resource_index = k_begin_index;
-				auto global_texture_resource_index = k_begin_index;
-				for (auto & group_index : SizeRange{definition.group.size()}) {
-					auto & group_definition = definition.group[group_index];
-					auto & group_id_structure = information_structure.group_id.at(global_group_index);
-					auto   standard_group_id = make_standard_group_id(group_definition.id, group_definition.composite);
-					group_id_structure.key = standard_group_id;
-					for (auto & subgroup_index : SizeRange{group_definition.subgroup.size()}) {
-						auto & subgroup_definition = group_definition.subgroup[subgroup_index];
-						auto & subgroup_id_structure = information_structure.subgroup_id.at(global_subgroup_index);
-						subgroup_id_structure.key = subgroup_definition.id;
-						for (auto & resource_index : SizeRange{subgroup_definition.resource.size()}) {
-							auto & resource_definition = subgroup_definition.resource[resource_index];
-							auto & resource_path_structure = information_structure.resource_path.at(global_resource_index);
-							resource_path_structure.key = resource_definition.path.to_string(CharacterType::PathSeparator::windows);
-							switch (resource_definition.additional.type().value) {
-								case ResourceType::Constant::general().value : {
-									auto & resource_additional_definition = resource_definition.additional.template get_of_type<ResourceType::Constant::general()>();
-									++global_general_resource_index;
-									break;
-								}
-								case ResourceType::Constant::texture().value : {
-									auto & resource_additional_definition = resource_definition.additional.template get_of_type<ResourceType::Constant::texture()>();
-									auto & texture_information_structure = information_structure.texture_resource_information[global_texture_resource_index];
-									++global_texture_resource_index;
-									break;
-								}
-							}
-							++global_resource_index;
-						}
-						++global_subgroup_index;
-					}
-					++global_group_index;
-				}
-				CompiledMapData::adjust_sequence(information_structure.group_id);
-				CompiledMapData::adjust_sequence(information_structure.subgroup_id);
-				CompiledMapData::adjust_sequence(information_structure.resource_path);
+				make_information_structure_for_layout(definition, information_structure);
 				information_data.header = OByteStreamView{
 					data.forward_view(bs_size(information_structure.header))
 				};
@@ -348,7 +419,9 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 				information_structure.header.information_without_manifest_section_size = cbw<IntegerU32>(data.position());
 			}
 			if (manifest.has()) {
-				process_package_manifest(data, information_structure.header, manifest.get());
+				auto manifest_information = ManifestInformation{};
+				make_package_manifest(manifest.get(), manifest_information);
+				process_package_manifest(data, information_structure.header, manifest_information);
 			}
 			else {
 				information_structure.header.group_manifest_information_section_offset = cbw<IntegerU32>(k_none_size);
@@ -357,6 +430,7 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 			}
 			data.write_space(k_null_byte, compute_padding_size(data.position(), k_padding_unit_size));
 			information_structure.header.information_section_size = cbw<IntegerU32>(data.position());
+			auto package_data_position = data.position();
 			information_structure.group_id.allocate_full(global_group_count);
 			information_structure.group_information.allocate_full(global_group_count);
 			information_structure.subgroup_id.allocate_full(global_subgroup_count);
@@ -385,6 +459,7 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 					auto & subgroup_information_structure = information_structure.subgroup_information[global_subgroup_index];
 					auto & pool_information_structure = information_structure.pool_information[global_subgroup_index];
 					auto   packet_package_definition = typename ResourceStreamGroup::Definition<packet_version>::Package{};
+					auto   packet_span = TraceSpan{"popcap.resource_stream_bundle.pack.packet"_sv};
 					simple_subgroup_information_structure.index = cbw<IntegerU32>(global_subgroup_index);
 					if constexpr (check_version(version, {1}, {})) {
 						if (!subgroup_definition.category.resolution.has()) {
@@ -456,12 +531,28 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 						}
 						++global_resource_index;
 					}
-					auto packet_data = OByteStreamView{data.reserve_view()};
+					auto legacy_packet_file = Optional<Path>{};
+					if (packet_file.has()) {
+						if (FileSystem::exist_file(make_formatted_path(packet_file.get()))) {
+							legacy_packet_file.set(make_formatted_path(packet_file.get()));
+						}
+					}
+					auto packet_data = packet_begin(
+						[&] (
+						) -> Size {
+							if (legacy_packet_file.has()) {
+								return FileSystem::size_file(legacy_packet_file.get());
+							}
+							auto packet_size_bound = Size{};
+							ResourceStreamGroup::Pack<packet_version>::estimate(packet_package_definition, make_formatted_path(resource_directory), packet_size_bound);
+							return packet_size_bound;
+						}
+					);
 					auto use_legacy_packet = k_false;
 					auto packet_header_structure = ResourceStreamGroup::Structure::Header<packet_version>{};
 					if (packet_file.has()) {
-						if (FileSystem::exist_file(make_formatted_path(packet_file.get()))) {
-							auto legacy_packet_size = FileSystem::read_stream_file(make_formatted_path(packet_file.get()), packet_data);
+						if (legacy_packet_file.has()) {
+							auto legacy_packet_size = FileSystem::read_stream_file(legacy_packet_file.get(), packet_data);
 							auto legacy_packet_stream = IByteStreamView{packet_data.prev_view(legacy_packet_size)};
 							legacy_packet_stream.read_constant(ResourceStreamGroup::Structure::k_magic_identifier);
 							legacy_packet_stream.read_constant(cbw<ResourceStreamGroup::Structure::VersionNumber>(packet_version.number));
@@ -477,7 +568,7 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 						auto legacy_packet_stream = IByteStreamView{packet_data.stream_view(), bs_static_size<ResourceStreamGroup::Structure::MagicIdentifier>() + bs_static_size<ResourceStreamGroup::Structure::VersionNumber>()};
 						legacy_packet_stream.read(packet_header_structure);
 					}
-					subgroup_information_structure.offset = cbw<IntegerU32>(data.position());
+					subgroup_information_structure.offset = cbw<IntegerU32>(package_data_position);
 					subgroup_information_structure.size = cbw<IntegerU32>(packet_data.position());
 					subgroup_information_structure.resource_data_section_compression = packet_header_structure.resource_data_section_compression;
 					subgroup_information_structure.information_section_size = packet_header_structure.information_section_size;
@@ -501,7 +592,9 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 						pool_information_structure.texture_resource_begin = 0_iu32;
 						pool_information_structure.texture_resource_count = 0_iu32;
 					}
-					data.forward(packet_data.position());
+					packet_span.set_byte(k_none_size, packet_data.position());
+					packet_end(package_data_position, packet_data);
+					package_data_position += packet_data.position();
 					++global_subgroup_index;
 				}
 				++global_group_index;
@@ -519,6 +612,91 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 				information_data.pool_information.write(information_structure.pool_information);
 				information_data.texture_resource_information.write(information_structure.texture_resource_information);
 			}
+			span.set_byte(k_none_size, package_data_position);
+			return;
+		}
+
+		static auto process_package (
+			OByteStreamView &                            data,
+			typename Definition::Package const &         definition,
+			Optional<typename Manifest::Package> const & manifest,
+			Path const &                                 resource_directory,
+			Optional<Path> const &                       packet_file,
+			Optional<Path> const &                       new_packet_file
+		) -> Void {
+			return process_package_with(
+				data,
+				definition,
+				manifest,
+				resource_directory,
+				packet_file,
+				new_packet_file,
+				[&] (
+					auto const & estimator
+				) -> OByteStreamView {
+					return OByteStreamView{data.reserve_view()};
+				},
+				[&] (
+					Size const &      offset,
+					OByteStreamView & packet_data
+				) -> Void {
+					data.forward(packet_data.position());
+					return;
+				}
+			);
+		}
+
+		// NOTE
+		// the information section is kept in memory and written back at last, each packet is flushed to file once it is built
+		// so the resident memory is bounded by the information section plus the biggest packet, instead of the whole bundle
+		static auto process_package_file (
+			Path const &                                 data_file,
+			typename Definition::Package const &         definition,
+			Optional<typename Manifest::Package> const & manifest,
+			Path const &                                 resource_directory,
+			Optional<Path> const &                       packet_file,
+			Optional<Path> const &                       new_packet_file
+		) -> Void {
+			auto information_section_size_bound = Size{};
+			estimate_package_information(definition, manifest, information_section_size_bound);
+			auto information_buffer = ByteArray{information_section_size_bound};
+			auto information_data = OByteStreamView{information_buffer};
+			auto packet_buffer = ByteArray{};
+			FileSystem::write_block_file(
+				data_file,
+				[&] (
+					auto const & writer
+				) -> Void {
+					process_package_with(
+						information_data,
+						definition,
+						manifest,
+						resource_directory,
+						packet_file,
+						new_packet_file,
+						[&] (
+							auto const & estimator
+						) -> OByteStreamView {
+							auto packet_size_bound = estimator();
+							if (packet_buffer.size() < packet_size_bound) {
+								packet_buffer.allocate(packet_size_bound);
+							}
+							return OByteStreamView{packet_buffer};
+						},
+						[&] (
+							Size const &      offset,
+							OByteStreamView & packet_data
+						) -> Void {
+							auto write_span = TraceSpan{"popcap.resource_stream_bundle.pack.write"_sv};
+							writer(offset, packet_data.stream_view());
+							write_span.set_byte(packet_data.position(), packet_data.position());
+							return;
+						}
+					);
+					writer(k_begin_index, information_data.stream_view());
+					return;
+				}
+			);
 			return;
 		}
 
@@ -536,6 +714,17 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 			return process_package(data, definition, manifest, resource_directory, packet_file, new_packet_file);
 		}
 
+		static auto process_file (
+			Path const &                                 data_file,
+			typename Definition::Package const &         definition,
+			Optional<typename Manifest::Package> const & manifest,
+			Path const &                                 resource_directory,
+			Optional<Path> const &                       packet_file,
+			Optional<Path> const &                       new_packet_file
+		) -> Void {
+			return process_package_file(data_file, definition, manifest, resource_directory, packet_file, new_packet_file);
+		}
+
 	};
 
 }
@@ -18,6 +18,8 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 
 		using typename Common::Manifest;
 
+		using typename Common::Index;
+
 		using Common::k_suffix_of_composite_shell_upper;
 
 		using Common::k_suffix_of_composite_shell;
@@ -137,6 +139,41 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 			return;
 		}
 
+		static auto process_package_information (
+			IByteStreamView &                 data,
+			Structure::Information<version> & information_structure
+		) -> Void {
+			data.read_constant(Structure::k_magic_identifier);
+			data.read_constant(cbw<Structure::VersionNumber>(version.number));
+			data.read(information_structure.header);
+			if constexpr (check_version(version, {1, 3}, {})) {
+				assert_test(information_structure.header.unknown_1 == 1_iu32);
+			}
+			if constexpr (check_version(version, {3}, {})) {
+				assert_test(information_structure.header.unknown_1 == 0_iu32);
+			}
+			assert_test(cbw<Size>(information_structure.header.group_information_section_block_size) == bs_static_size<Structure::GroupInformation<version>>());
+			assert_test(cbw<Size>(information_structure.header.subgroup_information_section_block_size) == bs_static_size<Structure::SubgroupInformation<version>>());
+			assert_test(cbw<Size>(information_structure.header.pool_information_section_block_size) == bs_static_size<Structure::PoolInformation<version>>());
+			assert_test(cbw<Size>(information_structure.header.texture_resource_information_section_block_size) == bs_static_size<Structure::TextureResourceInformation<version>>());
+			CompiledMapData::decode(information_structure.group_id, as_lvalue(IByteStreamView{data.sub_view(cbw<Size>(information_structure.header.group_id_section_offset), cbw<Size>(information_structure.header.group_id_section_size))}));
+			CompiledMapData::decode(information_structure.subgroup_id, as_lvalue(IByteStreamView{data.sub_view(cbw<Size>(information_structure.header.subgroup_id_section_offset), cbw<Size>(information_structure.header.subgroup_id_section_size))}));
+			CompiledMapData::decode(information_structure.resource_path, as_lvalue(IByteStreamView{data.sub_view(cbw<Size>(information_structure.header.resource_path_section_offset), cbw<Size>(information_structure.header.resource_path_section_size))}));
+			data.set_position(cbw<Size>(information_structure.header.group_information_section_offset));
+			data.read(information_structure.group_information, cbw<Size>(information_structure.header.group_information_section_block_count));
+			data.set_position(cbw<Size>(information_structure.header.subgroup_information_section_offset));
+			data.read(information_structure.subgroup_information, cbw<Size>(information_structure.header.subgroup_information_section_block_count));
+			data.set_position(cbw<Size>(information_structure.header.pool_information_section_offset));
+			data.read(information_structure.pool_information, cbw<Size>(information_structure.header.pool_information_section_block_count));
+			data.set_position(cbw<Size>(information_structure.header.texture_resource_information_section_offset));
+			data.read(information_structure.texture_resource_information, cbw<Size>(information_structure.header.texture_resource_information_section_block_count));
+			assert_test(information_structure.group_id.size() == cbw<Size>(information_structure.header.group_information_section_block_count));
+			assert_test(information_structure.subgroup_id.size() == cbw<Size>(information_structure.header.subgroup_information_section_block_count));
+			return;
+		}
+
+		// ----------------
+
 		static auto process_package (
 			IByteStreamView &                      data,
 			typename Definition::Package &         definition,
@@ -145,38 +182,11 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 			Optional<Path> const &                 packet_file
 		) -> Void {
 			constexpr auto packet_version = ResourceStreamGroup::Version{.number = version.number};
-			data.read_constant(Structure::k_magic_identifier);
-			data.read_constant(cbw<Structure::VersionNumber>(version.number));
 			auto information_structure = Structure::Information<version>{};
-			{
-				data.read(information_structure.header);
-				if constexpr (check_version(version, {1, 3}, {})) {
-					assert_test(information_structure.header.unknown_1 == 1_iu32);
-				}
-				if constexpr (check_version(version, {3}, {})) {
-					assert_test(information_structure.header.unknown_1 == 0_iu32);
-				}
-				assert_test(cbw<Size>(information_structure.header.group_information_section_block_size) == bs_static_size<Structure::GroupInformation<version>>());
-				assert_test(cbw<Size>(information_structure.header.subgroup_information_section_block_size) == bs_static_size<Structure::SubgroupInformation<version>>());
-				assert_test(cbw<Size>(information_structure.header.pool_information_section_block_size) == bs_static_size<Structure::PoolInformation<version>>());
-				assert_test(cbw<Size>(information_structure.header.texture_resource_information_section_block_size) == bs_static_size<Structure::TextureResourceInformation<version>>());
-				CompiledMapData::decode(information_structure.group_id, as_lvalue(IByteStreamView{data.sub_view(cbw<Size>(information_structure.header.group_id_section_offset), cbw<Size>(information_structure.header.group_id_section_size))}));
-				CompiledMapData::decode(information_structure.subgroup_id, as_lvalue(IByteStreamView{data.sub_view(cbw<Size>(information_structure.header.subgroup_id_section_offset), cbw<Size>(information_structure.header.subgroup_id_section_size))}));
-				CompiledMapData::decode(information_structure.resource_path, as_lvalue(IByteStreamView{data.sub_view(cbw<Size>(information_structure.header.resource_path_section_offset), cbw<Size>(information_structure.header.resource_path_section_size))}));
-				data.set_position(cbw<Size>(information_structure.header.group_information_section_offset));
-				data.read(information_structure.group_information, cbw<Size>(information_structure.header.group_information_section_block_count));
-				data.set_position(cbw<Size>(information_structure.header.subgroup_information_section_offset));
-				data.read(information_structure.subgroup_information, cbw<Size>(information_structure.header.subgroup_information_section_block_count));
-				data.set_position(cbw<Size>(information_structure.header.pool_information_section_offset));
-				data.read(information_structure.pool_information, cbw<Size>(information_structure.header.pool_information_section_block_count));
-				data.set_position(cbw<Size>(information_structure.header.texture_resource_information_section_offset));
-				data.read(information_structure.texture_resource_information, cbw<Size>(information_structure.header.texture_resource_information_section_block_count));
-				if (information_structure.header.group_manifest_information_section_offset != 0_iu32 || information_structure.header.resource_manifest_information_section_offset != 0_iu32 || information_structure.header.string_manifest_information_section_offset != 0_iu32) {
-					assert_test(information_structure.header.group_manifest_information_section_offset != 0_iu32 && information_structure.header.resource_manifest_information_section_offset != 0_iu32 && information_structure.header.string_manifest_information_section_offset != 0_iu32);
-					process_package_manifest(data, information_structure.header, manifest.set());
-				}
-				assert_test(information_structure.group_id.size() == cbw<Size>(information_structure.header.group_information_section_block_count));
-				assert_test(information_structure.subgroup_id.size() == cbw<Size>(information_structure.header.subgroup_information_section_block_count));
+			process_package_information(data, information_structure);
+			if (information_structure.header.group_manifest_information_section_offset != 0_iu32 || information_structure.header.resource_manifest_information_section_offset != 0_iu32 || information_structure.header.string_manifest_information_section_offset != 0_iu32) {
+				assert_test(information_structure.header.group_manifest_information_section_offset != 0_iu32 && information_structure.header.resource_manifest_information_section_offset != 0_iu32 && information_structure.header.string_manifest_information_section_offset != 0_iu32);
+				process_package_manifest(data, information_structure.header, manifest.set());
 			}
 			auto group_id_list = Map<Size, String>{};
 			auto subgroup_id_list = Map<Size, String>{};
@@ -194,6 +204,12 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 					destination_element.value = source_element.key;
 				}
 			);
+			auto packet_cache_bundle = Optional<IntegerU64>{};
+			if (ResourceStreamGroup::g_packet_cache.enabled()) {
+				packet_cache_bundle.set(ResourceStreamGroup::PacketCache::compute_bundle_identity(data.view().head(cbw<Size>(information_structure.header.information_section_size)), data.size()));
+			}
+			// NOTE : the packet definition die at the end of each subgroup, so it is decoded in an arena that is reset before every packet
+			auto packet_arena = Arena{};
 			definition.group.allocate_full(information_structure.group_information.size());
 			auto package_data_end_position = cbw<Size>(information_structure.header.information_section_size);
 			for (auto & group_index : SizeRange{information_structure.group_information.size()}) {
@@ -235,7 +251,15 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 					auto packet_data = data.sub_view(cbw<Size>(subgroup_information_structure.offset), cbw<Size>(subgroup_information_structure.size));
 					auto packet_stream = IByteStreamView{packet_data};
 					auto packet_package_definition = typename ResourceStreamGroup::Definition<packet_version>::Package{};
-					ResourceStreamGroup::Unpack<packet_version>::process(packet_stream, packet_package_definition, !resource_directory.has() ? (k_null_optional) : (make_optional_of(make_formatted_path(resource_directory.get()))));
+					auto packet_cache_key = Optional<ResourceStreamGroup::PacketCache::Key>{};
+					if (packet_cache_bundle.has()) {
+						packet_cache_key.set(ResourceStreamGroup::PacketCache::Key{.bundle = packet_cache_bundle.get(), .subgroup = cbw<Size>(simple_subgroup_information_structure.index)});
+					}
+					packet_arena.reset();
+					{
+						auto arena_scope = ArenaScope{packet_arena};
+						ResourceStreamGroup::Unpack<packet_version>::process_package(packet_stream, packet_package_definition, !resource_directory.has() ? (k_null_optional) : (make_optional_of(make_formatted_path(resource_directory.get()))), packet_cache_key);
+					}
 					assert_test(packet_stream.full());
 					if (packet_file.has()) {
 						FileSystem::write_file(make_formatted_path(packet_file.get()), packet_data);
@@ -290,6 +314,97 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 			return;
 		}
 
+		static auto process_index_package (
+			IByteStreamView &         data,
+			typename Index::Package & index
+		) -> Void {
+			auto information_structure = Structure::Information<version>{};
+			process_package_information(data, information_structure);
+			auto subgroup_resource_list = List<List<Path>>{};
+			subgroup_resource_list.allocate_full(information_structure.subgroup_information.size());
+			for (auto & resource_index : SizeRange{information_structure.resource_path.size()}) {
+				auto & resource_path_structure = information_structure.resource_path.at(resource_index);
+				subgroup_resource_list[cbw<Size>(resource_path_structure.value)].append().from_string(resource_path_structure.key);
+			}
+			auto group_id_list = Map<Size, String>{};
+			auto subgroup_id_list = Map<Size, String>{};
+			group_id_list.convert(
+				information_structure.group_id,
+				[] (auto & destination_element, auto & source_element) {
+					destination_element.key = cbw<Size>(source_element.value);
+					destination_element.value = source_element.key;
+				}
+			);
+			subgroup_id_list.convert(
+				information_structure.subgroup_id,
+				[] (auto & destination_element, auto & source_element) {
+					destination_element.key = cbw<Size>(source_element.value);
+					destination_element.value = source_element.key;
+				}
+			);
+			index.group.allocate_full(information_structure.group_information.size());
+			for (auto & group_index : SizeRange{information_structure.group_information.size()}) {
+				auto & group_information_structure = information_structure.group_information[group_index];
+				auto & group_index_item = index.group[group_index];
+				make_original_group_id_upper(group_id_list[group_index], group_index_item.composite, group_index_item.id);
+				group_index_item.subgroup.allocate_full(cbw<Size>(group_information_structure.subgroup_count));
+				for (auto & subgroup_index : SizeRange{cbw<Size>(group_information_structure.subgroup_count)}) {
+					auto & simple_subgroup_information_structure = group_information_structure.subgroup_information[subgroup_index];
+					auto & subgroup_information_structure = information_structure.subgroup_information[cbw<Size>(simple_subgroup_information_structure.index)];
+					auto & pool_information_structure = information_structure.pool_information[cbw<Size>(subgroup_information_structure.pool)];
+					auto & subgroup_index_item = group_index_item.subgroup[subgroup_index];
+					subgroup_index_item.id = subgroup_id_list[cbw<Size>(simple_subgroup_information_structure.index)];
+					if constexpr (check_version(version, {1}, {})) {
+						if (simple_subgroup_information_structure.resolution == 0x00000000_iu32) {
+							subgroup_index_item.category.resolution.reset();
+						}
+						else {
+							subgroup_index_item.category.resolution.set(cbw<Integer>(simple_subgroup_information_structure.resolution));
+						}
+					}
+					if constexpr (check_version(version, {3}, {})) {
+						if (simple_subgroup_information_structure.locale == 0x00000000_iu32) {
+							subgroup_index_item.category.locale.reset();
+						}
+						else {
+							subgroup_index_item.category.locale.set().from(fourcc_from_integer(simple_subgroup_information_structure.locale));
+						}
+					}
+					subgroup_index_item.compression = packet_compression_from_data(subgroup_information_structure.resource_data_section_compression);
+					subgroup_index_item.offset = cbw<Integer>(subgroup_information_structure.offset);
+					subgroup_index_item.size = cbw<Integer>(subgroup_information_structure.size);
+					subgroup_index_item.resource = as_moveable(subgroup_resource_list[cbw<Size>(simple_subgroup_information_structure.index)]);
+					auto texture_resource_begin = Size{};
+					auto texture_resource_count = Size{};
+					if constexpr (check_version(version, {1, 3}, {})) {
+						texture_resource_begin = cbw<Size>(pool_information_structure.texture_resource_begin);
+						texture_resource_count = cbw<Size>(pool_information_structure.texture_resource_count);
+					}
+					if constexpr (check_version(version, {3}, {})) {
+						texture_resource_begin = cbw<Size>(subgroup_information_structure.texture_resource_begin);
+						texture_resource_count = cbw<Size>(subgroup_information_structure.texture_resource_count);
+					}
+					subgroup_index_item.texture_resource.allocate_full(texture_resource_count);
+					for (auto & texture_resource_index : SizeRange{texture_resource_count}) {
+						auto & texture_information_structure = information_structure.texture_resource_information[texture_resource_begin + texture_resource_index];
+						auto & texture_resource_index_item = subgroup_index_item.texture_resource[texture_resource_index];
+						texture_resource_index_item.size.width = cbw<Integer>(texture_information_structure.size_width);
+						texture_resource_index_item.size.height = cbw<Integer>(texture_information_structure.size_height);
+						texture_resource_index_item.format = cbw<Integer>(texture_information_structure.format);
+						texture_resource_index_item.pitch = cbw<Integer>(texture_information_structure.pitch);
+						if constexpr (check_version(version, {4}, {1})) {
+							texture_resource_index_item.additional_byte_count = cbw<Integer>(texture_information_structure.additional_byte_count);
+						}
+						if constexpr (check_version(version, {4}, {2})) {
+							texture_resource_index_item.scale = cbw<Integer>(texture_information_structure.scale);
+						}
+					}
+				}
+			}
+			data.set_position(cbw<Size>(information_structure.header.information_section_size));
+			return;
+		}
+
 		// ----------------
 
 		static auto process (
@@ -302,7 +417,36 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundle {
 			M_use_zps_of(data);
 			restruct(definition);
 			restruct(manifest);
-			return process_package(data, definition, manifest, resource_directory, packet_file);
+			auto span = TraceSpan{"popcap.resource_stream_bundle.unpack"_sv};
+			process_package(data, definition, manifest, resource_directory, packet_file);
+			span.set_byte(data.position(), k_none_size);
+			return;
+		}
+
+		// ----------------
+
+		static auto process_index (
+			IByteStreamView &         data_,
+			typename Index::Package & index
+		) -> Void {
+			M_use_zps_of(data);
+			restruct(index);
+			return process_index_package(data, index);
+		}
+
+		// NOTE : only the header and information section are read from the file, packet data stay on disk
+		static auto process_index_file (
+			Path const &              data_file,
+			typename Index::Package & index
+		) -> Void {
+			auto header_section_size = bs_static_size<Structure::MagicIdentifier>() + bs_static_size<Structure::VersionNumber>() + bs_static_size<Structure::Header<version>>();
+			auto header_section_data = FileSystem::read_file_part(data_file, k_begin_index, header_section_size);
+			auto header_section_stream = IByteStreamView{header_section_data};
+			header_section_stream.read_constant(Structure::k_magic_identifier);
+			header_section_stream.read_constant(cbw<Structure::VersionNumber>(version.number));
+			auto header_structure = header_section_stream.read_of<Structure::Header<version>>();
+			auto information_section_data = FileSystem::read_file_part(data_file, k_begin_index, cbw<Size>(header_structure.information_section_size));
+			return process_index(as_lvalue(IByteStreamView{information_section_data}), index);
 		}
 
 	};
@@ -3,6 +3,7 @@
 #include "kernel/utility/utility.hpp"
 #include "kernel/tool/popcap/resource_stream_bundle_patch/version.hpp"
 #include "kernel/tool/popcap/resource_stream_group/structure.hpp"
+#include "kernel/tool/popcap/resource_stream_group/cache.hpp"
 
 namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundlePatch {
 
@@ -133,8 +134,9 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundlePatch {
 		}
 
 		static auto uncompress_packet (
-			IByteStreamView & ripe,
-			OByteStreamView & raw
+			IByteStreamView &                                       ripe,
+			OByteStreamView &                                       raw,
+			Optional<ResourceStreamGroup::PacketCache::Key> const & cache_key
 		) -> ResourceStreamGroup::Structure::Information<packet_version> {
 			ripe.read_constant(ResourceStreamGroup::Structure::k_magic_identifier);
 			ripe.read_constant(cbw<ResourceStreamGroup::Structure::VersionNumber>(packet_version.number));
@@ -159,13 +161,38 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundlePatch {
 			raw.write(ripe.sub_view(k_begin_index, cbw<Size>(information_structure.header.information_section_size)));
 			raw.write_space(k_null_byte, compute_padding_size(raw.position(), k_padding_unit_size));
 			auto resource_data_section_compression = packet_compression_from_data(information_structure.header.resource_data_section_compression);
+			auto uncompress_section =
+				[&] (
+				CByteListView const & resource_data_section_view,
+				Size const &          resource_data_section_size_original,
+				ResourceType const &  resource_type
+			) -> Void {
+				if (!cache_key.has() || !ResourceStreamGroup::g_packet_cache.enabled()) {
+					Data::Compression::Deflate::Uncompress::process(as_lvalue(IByteStreamView{resource_data_section_view}), raw, 15_sz, Data::Compression::Deflate::Wrapper::Constant::zlib());
+					return;
+				}
+				auto resource_data_section = ResourceStreamGroup::g_packet_cache.query(
+					cache_key.get(),
+					resource_type,
+					resource_data_section_view,
+					[&] (
+					ByteArray & resource_data_section_original
+				) -> Void {
+						resource_data_section_original.allocate(resource_data_section_size_original);
+						Data::Compression::Deflate::Uncompress::process(as_lvalue(IByteStreamView{resource_data_section_view}), as_lvalue(OByteStreamView{resource_data_section_original}), 15_sz, Data::Compression::Deflate::Wrapper::Constant::zlib());
+						return;
+					}
+				);
+				raw.write(resource_data_section->view());
+				return;
+			};
 			{
 				auto resource_data_section_view = ripe.sub_view(cbw<Size>(information_structure.header.general_resource_data_section_offset), cbw<Size>(information_structure.header.general_resource_data_section_size));
 				if (!resource_data_section_compression.general) {
 					raw.write(resource_data_section_view);
 				}
 				else {
-					Data::Compression::Deflate::Uncompress::process(as_lvalue(IByteStreamView{resource_data_section_view}), raw, 15_sz, Data::Compression::Deflate::Wrapper::Constant::zlib());
+					uncompress_section(resource_data_section_view, cbw<Size>(information_structure.header.general_resource_data_section_size_original), ResourceType::Constant::general());
 				}
 				raw.write_space(k_null_byte, compute_padding_size(raw.position(), k_padding_unit_size));
 			}
@@ -175,13 +202,36 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundlePatch {
 					raw.write(resource_data_section_view);
 				}
 				else {
-					Data::Compression::Deflate::Uncompress::process(as_lvalue(IByteStreamView{resource_data_section_view}), raw, 15_sz, Data::Compression::Deflate::Wrapper::Constant::zlib());
+					uncompress_section(resource_data_section_view, cbw<Size>(information_structure.header.texture_resource_data_section_size_original), ResourceType::Constant::texture());
 				}
 				raw.write_space(k_null_byte, compute_padding_size(raw.position(), k_padding_unit_size));
 			}
 			return information_structure;
 		}
 
+		static auto compute_packet_cache_bundle (
+			CByteListView const & information_section,
+			Size const &          size,
+			Boolean const &       use_raw_packet
+		) -> Optional<IntegerU64> {
+			auto bundle = Optional<IntegerU64>{};
+			if (use_raw_packet && ResourceStreamGroup::g_packet_cache.enabled()) {
+				bundle.set(ResourceStreamGroup::PacketCache::compute_bundle_identity(information_section, size));
+			}
+			return bundle;
+		}
+
+		static auto make_packet_cache_key (
+			Optional<IntegerU64> const & bundle,
+			Size const &                 subgroup
+		) -> Optional<ResourceStreamGroup::PacketCache::Key> {
+			auto key = Optional<ResourceStreamGroup::PacketCache::Key>{};
+			if (bundle.has()) {
+				key.set(ResourceStreamGroup::PacketCache::Key{.bundle = bundle.get(), .subgroup = subgroup});
+			}
+			return key;
+		}
+
 		// ----------------
 
 		static auto indexing_subgroup_information_by_id (
@@ -31,6 +31,10 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundlePatch {
 
 		using Common::uncompress_packet;
 
+		using Common::compute_packet_cache_bundle;
+
+		using Common::make_packet_cache_key;
+
 		using Common::indexing_subgroup_information_by_id;
 
 		// ----------------
@@ -85,6 +89,7 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundlePatch {
 			read_package_information_structure(as_lvalue(IByteStreamView{after.view()}), information_section_after_structure);
 			assert_test(packet_count == information_section_after_structure.subgroup_information.size());
 			auto packet_before_subgroup_information_index_map = indexing_subgroup_information_by_id(information_section_before_structure.subgroup_information);
+			auto packet_before_cache_bundle = compute_packet_cache_bundle(information_section_before, before.size(), use_raw_packet);
 			auto packet_before_raw_container = ByteArray{};
 			auto packet_after_raw_container = ByteArray{};
 			auto before_end_position = cbw<Size>(information_section_before_structure.header.information_section_size);
@@ -114,7 +119,7 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundlePatch {
 							packet_before_raw_container.allocate(packet_before_raw_size);
 						}
 						auto packet_before_raw = OByteStreamView{packet_before_raw_container};
-						uncompress_packet(packet_before_ripe, packet_before_raw);
+						uncompress_packet(packet_before_ripe, packet_before_raw, make_packet_cache_key(packet_before_cache_bundle, cbw<Size>(packet_before_subgroup_information_index.get().value)));
 						assert_test(packet_before_ripe.full());
 						packet_before = packet_before_raw.stream_view();
 					}
@@ -31,6 +31,10 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundlePatch {
 
 		using Common::uncompress_packet;
 
+		using Common::compute_packet_cache_bundle;
+
+		using Common::make_packet_cache_key;
+
 		using Common::indexing_subgroup_information_by_id;
 
 		// ----------------
@@ -88,7 +92,9 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundlePatch {
 			package_information.patch_exist = cbw<IntegerU32>(information_section_patch_exist);
 			package_information.patch_size = cbw<IntegerU32>(information_section_patch_size);
 			auto packet_before_subgroup_information_index_map = indexing_subgroup_information_by_id(information_section_before_structure.subgroup_information);
+			auto packet_before_cache_bundle = compute_packet_cache_bundle(information_section_before, before.size(), use_raw_packet);
 			auto packet_before_raw_container = ByteArray{};
+			auto packet_after_cache_bundle = compute_packet_cache_bundle(information_section_after, after.size(), use_raw_packet);
 			auto packet_after_raw_container = ByteArray{};
 			auto before_end_position = cbw<Size>(information_section_before_structure.header.information_section_size);
 			auto after_end_position = cbw<Size>(information_section_after_structure.header.information_section_size);
@@ -115,7 +121,7 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundlePatch {
 							packet_before_raw_container.allocate(packet_before_raw_size);
 						}
 						auto packet_before_raw = OByteStreamView{packet_before_raw_container};
-						uncompress_packet(packet_before_ripe, packet_before_raw);
+						uncompress_packet(packet_before_ripe, packet_before_raw, make_packet_cache_key(packet_before_cache_bundle, cbw<Size>(packet_before_subgroup_information_index.get().value)));
 						assert_test(packet_before_ripe.full());
 						packet_before = packet_before_raw.stream_view();
 					}
@@ -134,7 +140,7 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamBundlePatch {
 							packet_after_raw_container.allocate(packet_after_raw_size);
 						}
 						auto packet_after_raw = OByteStreamView{packet_after_raw_container};
-						uncompress_packet(packet_after_ripe, packet_after_raw);
+						uncompress_packet(packet_after_ripe, packet_after_raw, make_packet_cache_key(packet_after_cache_bundle, packet_index));
 						assert_test(packet_after_ripe.full());
 						packet_after = packet_after_raw.stream_view();
 					}
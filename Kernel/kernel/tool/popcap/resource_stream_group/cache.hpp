@@ -0,0 +1,246 @@
+#pragma once
+
+#include "kernel/utility/utility.hpp"
+#include "kernel/tool/popcap/resource_stream_bundle/shared.hpp"
+#include "kernel/tool/data/hash/fnv/hash.hpp"
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamGroup {
+
+	// NOTE
+	// LRU cache of inflated packet resource data section, keyed by bundle identity and subgroup index
+	// bundle identity is the hash of the information section and the total size, the entry is further keyed by the hash of the stored section, so a bundle rewritten in place never hit a stale entry
+	// the budget limit the total byte size of cached section, zero budget disable the cache
+	// section returned by query is shared, evicted section stay alive until every user released it
+	class PacketCache {
+
+	public:
+
+		struct Key {
+			IntegerU64 bundle;
+			Size       subgroup;
+		};
+
+		// ----------------
+
+		using Section = std::shared_ptr<ByteArray const>;
+
+	protected:
+
+		struct EntryKey {
+			ZIntegerU64 bundle;
+			ZSize       subgroup;
+			ZSize       type;
+			ZIntegerU64 content;
+
+			auto operator == (
+				EntryKey const & that
+			) const -> bool = default;
+		};
+
+		struct EntryKeyHasher {
+			auto operator () (
+				EntryKey const & key
+			) const -> std::size_t {
+				auto value = key.bundle;
+				value ^= key.subgroup + 0x9E3779B97F4A7C15ull + (value << 6) + (value >> 2);
+				value ^= key.type + 0x9E3779B97F4A7C15ull + (value << 6) + (value >> 2);
+				value ^= key.content + 0x9E3779B97F4A7C15ull + (value << 6) + (value >> 2);
+				return static_cast<std::size_t>(value);
+			}
+		};
+
+		using Entry = std::pair<EntryKey, Section>;
+
+		// ----------------
+
+		Size m_budget;
+
+		Size m_usage;
+
+		std::list<Entry> m_entry;
+
+		std::unordered_map<EntryKey, typename std::list<Entry>::iterator, EntryKeyHasher> m_index;
+
+		std::mutex m_mutex;
+
+	public:
+
+		#pragma region structor
+
+		~PacketCache (
+		) = default;
+
+		// ----------------
+
+		PacketCache (
+		) :
+			m_budget{k_none_size},
+			m_usage{k_none_size},
+			m_entry{},
+			m_index{},
+			m_mutex{} {
+		}
+
+		PacketCache (
+			PacketCache const & that
+		) = delete;
+
+		PacketCache (
+			PacketCache && that
+		) = delete;
+
+		#pragma endregion
+
+		#pragma region operator
+
+		auto operator = (
+			PacketCache const & that
+		) -> PacketCache & = delete;
+
+		auto operator = (
+			PacketCache && that
+		) -> PacketCache & = delete;
+
+		#pragma endregion
+
+		#pragma region budget
+
+		auto budget (
+		) -> Size {
+			auto lock = std::lock_guard<std::mutex>{thiz.m_mutex};
+			return thiz.m_budget;
+		}
+
+		auto usage (
+		) -> Size {
+			auto lock = std::lock_guard<std::mutex>{thiz.m_mutex};
+			return thiz.m_usage;
+		}
+
+		auto enabled (
+		) -> Boolean {
+			return thiz.budget() != k_none_size;
+		}
+
+		// ----------------
+
+		auto set_budget (
+			Size const & budget
+		) -> Void {
+			auto lock = std::lock_guard<std::mutex>{thiz.m_mutex};
+			thiz.m_budget = budget;
+			thiz.evict();
+			return;
+		}
+
+		auto clear (
+		) -> Void {
+			auto lock = std::lock_guard<std::mutex>{thiz.m_mutex};
+			thiz.m_entry.clear();
+			thiz.m_index.clear();
+			thiz.m_usage = k_none_size;
+			return;
+		}
+
+		#pragma endregion
+
+		#pragma region access
+
+		// NOTE : return the cached section, or call inflater(ByteArray &) to produce and cache it, stored is the compressed section that the inflater read
+		template <typename Inflater> requires
+			CategoryConstraint<IsPureInstance<Inflater>>
+			&& (IsGenericCallable<Inflater>)
+		auto query (
+			Key const &           key,
+			ResourceType const &  type,
+			CByteListView const & stored,
+			Inflater const &      inflater
+		) -> Section {
+			auto entry_key = EntryKey{key.bundle.value, key.subgroup.value, static_cast<ZSize>(type.value), compute_content_identity(stored).value};
+			{
+				auto lock = std::lock_guard<std::mutex>{thiz.m_mutex};
+				if (auto entry = thiz.m_index.find(entry_key); entry != thiz.m_index.end()) {
+					thiz.m_entry.splice(thiz.m_entry.begin(), thiz.m_entry, entry->second);
+					return entry->second->second;
+				}
+			}
+			// NOTE : inflate outside the lock, concurrent miss of same key may inflate twice but the result is identical
+			// NOTE : the section outlive the caller, so it never take memory from the arena of the caller
+			auto arena_scope = ArenaScope{k_null};
+			auto data = ByteArray{};
+			inflater(data);
+			auto section = std::make_shared<ByteArray const>(as_moveable(data));
+			{
+				auto lock = std::lock_guard<std::mutex>{thiz.m_mutex};
+				if (section->size() > thiz.m_budget || thiz.m_index.contains(entry_key)) {
+					return section;
+				}
+				thiz.m_entry.emplace_front(entry_key, section);
+				thiz.m_index.emplace(entry_key, thiz.m_entry.begin());
+				thiz.m_usage += section->size();
+				thiz.evict();
+			}
+			return section;
+		}
+
+		#pragma endregion
+
+		#pragma region utility
+
+		// NOTE : the packet data is not hashed here, each cached section is keyed by its own content identity
+		inline static auto compute_bundle_identity (
+			CByteListView const & information_section,
+			Size const &          size
+		) -> IntegerU64 {
+			constexpr auto mode = Data::Hash::FNV::Mode::Constant::m_1a();
+			constexpr auto bit_count = Data::Hash::FNV::BitCount::Constant::b_64();
+			auto value = IntegerU64{};
+			auto size_data = ByteArray{bs_static_size<IntegerU64>()};
+			OByteStreamView{size_data}.write(cbw<IntegerU64>(size));
+			Data::Hash::FNV::Hash::initialize_integer<mode, bit_count>(value);
+			Data::Hash::FNV::Hash::update_integer<mode, bit_count>(information_section, value);
+			Data::Hash::FNV::Hash::update_integer<mode, bit_count>(size_data, value);
+			return value;
+		}
+
+		// NOTE : hash of the stored section, cheap next to the inflation it save
+		inline static auto compute_content_identity (
+			CByteListView const & stored
+		) -> IntegerU64 {
+			constexpr auto mode = Data::Hash::FNV::Mode::Constant::m_1a();
+			constexpr auto bit_count = Data::Hash::FNV::BitCount::Constant::b_64();
+			auto value = IntegerU64{};
+			Data::Hash::FNV::Hash::process_whole_integer<mode, bit_count>(stored, value);
+			return value;
+		}
+
+		#pragma endregion
+
+	protected:
+
+		#pragma region implement
+
+		auto evict (
+		) -> Void {
+			while (thiz.m_usage > thiz.m_budget) {
+				auto & entry = thiz.m_entry.back();
+				thiz.m_usage -= entry.second->size();
+				thiz.m_index.erase(entry.first);
+				thiz.m_entry.pop_back();
+			}
+			return;
+		}
+
+		#pragma endregion
+
+	};
+
+	// ----------------
+
+	inline auto g_packet_cache = PacketCache{};
+
+}
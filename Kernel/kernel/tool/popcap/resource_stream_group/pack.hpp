@@ -16,6 +16,34 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamGroup {
 
 		// ----------------
 
+		static auto make_information_structure_for_layout (
+			typename Definition::Package const & definition,
+			Structure::Information<version> &    information_structure
+		) -> Void {
+			information_structure.resource_information.allocate_full(definition.resource.size());
+			for (auto & resource_index : SizeRange{definition.resource.size()}) {
+				auto & resource_definition = definition.resource[resource_index];
+				auto & resource_information_structure = information_structure.resource_information.at(resource_index);
+				resource_information_structure.key = resource_definition.path.to_string(CharacterType::PathSeparator::windows);
+				switch (resource_definition.additional.type().value) {
+					case ResourceType::Constant::general().value : {
+						resource_information_structure.value.type = Structure::ResourceTypeFlag<version>::general;
+						resource_information_structure.value.additional.template set_of_type<ResourceType::Constant::general()>();
+						break;
+					}
+					case ResourceType::Constant::texture().value : {
+						resource_information_structure.value.type = Structure::ResourceTypeFlag<version>::texture;
+						resource_information_structure.value.additional.template set_of_type<ResourceType::Constant::texture()>();
+						break;
+					}
+				}
+			}
+			CompiledMapData::adjust_sequence(information_structure.resource_information);
+			return;
+		}
+
+		// ----------------
+
 		static auto process_package (
 			OByteStreamView &                    data,
 			typename Definition::Package const & definition,
@@ -31,25 +59,7 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamGroup {
 				information_data = {};
 			{
 				auto information_structure = Structure::Information<version>{};
-				information_structure.resource_information.allocate_full(definition.resource.size());
-				for (auto & resource_index : SizeRange{definition.resource.size()}) {
-					auto & resource_definition = definition.resource[resource_index];
-					auto & resource_information_structure = information_structure.resource_information.at(resource_index);
-					resource_information_structure.key = resource_definition.path.to_string(CharacterType::PathSeparator::windows);
-					switch (resource_definition.additional.type().value) {
-						case ResourceType::Constant::general().value : {
-							resource_information_structure.value.type = Structure::ResourceTypeFlag<version>::general;
-							resource_information_structure.value.additional.template set_of_type<ResourceType::Constant::general()>();
-							break;
-						}
-						case ResourceType::Constant::texture().value : {
-							resource_information_structure.value.type = Structure::ResourceTypeFlag<version>::texture;
-							resource_information_structure.value.additional.template set_of_type<ResourceType::Constant::texture()>();
-							break;
-						}
-					}
-				}
-				CompiledMapData::adjust_sequence(information_structure.resource_information);
+				make_information_structure_for_layout(definition, information_structure);
 				information_data.header = OByteStreamView{
 					data.forward_view(bs_size(information_structure.header))
 				};
@@ -172,7 +182,56 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamGroup {
 			Path const &                         resource_directory
 		) -> Void {
 			M_use_zps_of(data);
-			return process_package(data, definition, resource_directory);
+			auto span = TraceSpan{"popcap.resource_stream_group.pack"_sv};
+			process_package(data, definition, resource_directory);
+			span.set_byte(k_none_size, data.position());
+			return;
+		}
+
+		// ----------------
+
+		// NOTE : the bound assume every compressed section meet the worst case of deflate
+		static auto estimate (
+			typename Definition::Package const & definition,
+			Path const &                         resource_directory,
+			Size &                               data_size_bound
+		) -> Void {
+			restruct(data_size_bound);
+			auto information_structure = Structure::Information<version>{};
+			make_information_structure_for_layout(definition, information_structure);
+			data_size_bound += bs_static_size<Structure::MagicIdentifier>() + bs_static_size<Structure::VersionNumber>();
+			data_size_bound += bs_size(information_structure.header);
+			data_size_bound += CompiledMapData::compute_ripe_size(information_structure.resource_information);
+			data_size_bound += compute_padding_size(data_size_bound, k_padding_unit_size);
+			for (auto & current_resource_type : make_static_array<ResourceType>(ResourceType::Constant::general(), ResourceType::Constant::texture())) {
+				auto resource_data_section_size_original = k_none_size;
+				for (auto & resource_definition : definition.resource) {
+					if (resource_definition.additional.type() != current_resource_type) {
+						continue;
+					}
+					resource_data_section_size_original += compute_padded_size(FileSystem::size_file(resource_directory / resource_definition.path), k_padding_unit_size);
+				}
+				auto compress_resource_data_section = k_false;
+				switch (current_resource_type.value) {
+					case ResourceType::Constant::general().value : {
+						compress_resource_data_section = definition.compression.general;
+						break;
+					}
+					case ResourceType::Constant::texture().value : {
+						compress_resource_data_section = definition.compression.texture;
+						break;
+					}
+				}
+				if (!compress_resource_data_section) {
+					data_size_bound += resource_data_section_size_original;
+				}
+				else {
+					auto resource_data_section_size_bound = Size{};
+					Data::Compression::Deflate::Compress::estimate(resource_data_section_size_original, resource_data_section_size_bound, 15_sz, 9_sz, Data::Compression::Deflate::Wrapper::Constant::zlib());
+					data_size_bound += compute_padded_size(resource_data_section_size_bound, k_padding_unit_size);
+				}
+			}
+			return;
 		}
 
 	};
@@ -2,6 +2,7 @@
 
 #include "kernel/utility/utility.hpp"
 #include "kernel/tool/popcap/resource_stream_group/common.hpp"
+#include "kernel/tool/popcap/resource_stream_group/cache.hpp"
 #include "kernel/tool/data/compression/deflate/uncompress.hpp"
 
 namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamGroup {
@@ -17,9 +18,10 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamGroup {
 		// ----------------
 
 		static auto process_package (
-			IByteStreamView &              data,
-			typename Definition::Package & definition,
-			Optional<Path> const &         resource_directory
+			IByteStreamView &                  data,
+			typename Definition::Package &     definition,
+			Optional<Path> const &             resource_directory,
+			Optional<PacketCache::Key> const & cache_key
 		) -> Void {
 			data.read_constant(Structure::k_magic_identifier);
 			data.read_constant(cbw<Structure::VersionNumber>(version.number));
@@ -38,7 +40,7 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamGroup {
 			definition.resource.allocate_full(information_structure.resource_information.size());
 			for (auto & current_resource_type : make_static_array<ResourceType>(ResourceType::Constant::general(), ResourceType::Constant::texture())) {
 				auto resource_data_section_view = CByteListView{};
-				auto resource_data_section_container = ByteArray{};
+				auto resource_data_section_container = PacketCache::Section{};
 				auto resource_data_section_offset = Size{};
 				auto resource_data_section_size = Size{};
 				auto resource_data_section_size_original = Size{};
@@ -64,13 +66,27 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamGroup {
 					resource_data_section_view = resource_data_section_view_stored;
 				}
 				else {
-					resource_data_section_container.allocate(resource_data_section_size_original);
-					if (resource_data_section_size_original != k_none_size) {
-						auto resource_data_section_stored_stream = IByteStreamView{resource_data_section_view_stored};
-						auto resource_data_section_original_stream = OByteStreamView{resource_data_section_container};
-						Data::Compression::Deflate::Uncompress::process(resource_data_section_stored_stream, resource_data_section_original_stream, 15_sz, Data::Compression::Deflate::Wrapper::Constant::zlib());
+					auto inflate_resource_data_section =
+						[&] (
+						ByteArray & resource_data_section_original
+					) -> Void {
+						resource_data_section_original.allocate(resource_data_section_size_original);
+						if (resource_data_section_size_original != k_none_size) {
+							auto resource_data_section_stored_stream = IByteStreamView{resource_data_section_view_stored};
+							auto resource_data_section_original_stream = OByteStreamView{resource_data_section_original};
+							Data::Compression::Deflate::Uncompress::process(resource_data_section_stored_stream, resource_data_section_original_stream, 15_sz, Data::Compression::Deflate::Wrapper::Constant::zlib());
+						}
+						return;
+					};
+					if (cache_key.has() && g_packet_cache.enabled()) {
+						resource_data_section_container = g_packet_cache.query(cache_key.get(), current_resource_type, resource_data_section_view_stored, inflate_resource_data_section);
 					}
-					resource_data_section_view = resource_data_section_container.view();
+					else {
+						auto resource_data_section_original = ByteArray{};
+						inflate_resource_data_section(resource_data_section_original);
+						resource_data_section_container = std::make_shared<ByteArray const>(as_moveable(resource_data_section_original));
+					}
+					resource_data_section_view = resource_data_section_container->view();
 				}
 				for (auto & resource_index : SizeRange{information_structure.resource_information.size()}) {
 					auto & resource_information_structure = information_structure.resource_information.at(resource_index);
@@ -125,7 +141,10 @@ namespace TwinStar::Kernel::Tool::PopCap::ResourceStreamGroup {
 		) -> Void {
 			M_use_zps_of(data);
 			restruct(definition);
-			return process_package(data, definition, resource_directory);
+			auto span = TraceSpan{"popcap.resource_stream_group.unpack"_sv};
+			process_package(data, definition, resource_directory, k_null_optional);
+			span.set_byte(data.position(), k_none_size);
+			return;
 		}
 
 	};
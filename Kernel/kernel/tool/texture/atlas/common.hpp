@@ -0,0 +1,141 @@
+#pragma once
+
+#include "kernel/utility/utility.hpp"
+
+namespace TwinStar::Kernel::Tool::Texture::Atlas {
+
+	M_enumeration(
+		M_wrap(ExpandMethod),
+		M_wrap(
+			exponent_of_2,
+			fixed,
+		),
+	);
+
+	M_enumeration(
+		M_wrap(ItemWeighter),
+		M_wrap(
+			area,
+			perimeter,
+			bigger_side,
+			width,
+			height,
+			pathological_multiplier,
+		),
+	);
+
+	using ItemWeighterPackage = ValuePackage<
+		ItemWeighter::Constant::area(),
+		ItemWeighter::Constant::perimeter(),
+		ItemWeighter::Constant::bigger_side(),
+		ItemWeighter::Constant::width(),
+		ItemWeighter::Constant::height(),
+		ItemWeighter::Constant::pathological_multiplier()
+	>;
+
+	// ----------------
+
+	struct Common {
+
+		struct Rectangle {
+			Size x;
+			Size y;
+			Size width;
+			Size height;
+		};
+
+		// ----------------
+
+		inline static auto rectangle_contain (
+			Rectangle const & outer,
+			Rectangle const & inner
+		) -> Boolean {
+			return inner.x >= outer.x && inner.y >= outer.y && inner.x + inner.width <= outer.x + outer.width && inner.y + inner.height <= outer.y + outer.height;
+		}
+
+		inline static auto rectangle_intersect (
+			Rectangle const & thix,
+			Rectangle const & that
+		) -> Boolean {
+			return thix.x < that.x + that.width && that.x < thix.x + thix.width && thix.y < that.y + that.height && that.y < thix.y + thix.height;
+		}
+
+		// ----------------
+
+		inline static auto compute_weight (
+			Image::ImageSize const & item,
+			ItemWeighter const &     weighter
+		) -> Floater {
+			auto width = cbw<Floater>(item.width);
+			auto height = cbw<Floater>(item.height);
+			auto result = Floater{};
+			switch (weighter.value) {
+				case ItemWeighter::Constant::area().value : {
+					result = width * height;
+					break;
+				}
+				case ItemWeighter::Constant::perimeter().value : {
+					result = 2.0_f * (width + height);
+					break;
+				}
+				case ItemWeighter::Constant::bigger_side().value : {
+					result = maximum(width, height);
+					break;
+				}
+				case ItemWeighter::Constant::width().value : {
+					result = width;
+					break;
+				}
+				case ItemWeighter::Constant::height().value : {
+					result = height;
+					break;
+				}
+				case ItemWeighter::Constant::pathological_multiplier().value : {
+					result = minimum(width, height) == 0.0_f ? (0.0_f) : (maximum(width, height) / minimum(width, height) * (width * height));
+					break;
+				}
+			}
+			return result;
+		}
+
+		inline static auto expand_container (
+			Image::ImageSize &   container,
+			Size const &         step,
+			ExpandMethod const & method,
+			Boolean const &      square,
+			Size const &         value
+		) -> Void {
+			switch (method.value) {
+				case ExpandMethod::Constant::exponent_of_2().value : {
+					if (square) {
+						container.width = maximum(container.width, 1_sz) * 2_sz;
+						container.height = maximum(container.height, 1_sz) * 2_sz;
+					}
+					else if (step % 2_sz == 0_sz) {
+						container.height = maximum(container.height, 1_sz) * 2_sz;
+					}
+					else {
+						container.width = maximum(container.width, 1_sz) * 2_sz;
+					}
+					break;
+				}
+				case ExpandMethod::Constant::fixed().value : {
+					if (square) {
+						container.width += value;
+						container.height += value;
+					}
+					else if (step % 2_sz == 0_sz) {
+						container.width += value;
+					}
+					else {
+						container.height += value;
+					}
+					break;
+				}
+			}
+			return;
+		}
+
+	};
+
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "kernel/utility/utility.hpp"
+#include "kernel/tool/texture/atlas/common.hpp"
+#include "kernel/tool/texture/atlas/definition.hpp"
+#include "kernel/tool/texture/file/png/read.hpp"
+
+namespace TwinStar::Kernel::Tool::Texture::Atlas {
+
+	struct Compose :
+		Common {
+
+		using Common = Common;
+
+		// ----------------
+
+		static auto process_atlas (
+			Image::VImageView const &  atlas,
+			Definition::Atlas const &  definition,
+			Path const &               sprite_directory
+		) -> Void {
+			assert_test(atlas.size() == definition.size);
+			// NOTE : sprite view is made in advance, every sprite own a disjoint region of atlas, so decoding can run concurrently
+			auto atlas_view = atlas;
+			auto sprite_view = List<Image::VImageView>{};
+			sprite_view.allocate(definition.sprite.size());
+			for (auto & sprite_definition : definition.sprite) {
+				sprite_view.append(atlas_view.sub(sprite_definition.position, sprite_definition.size));
+			}
+			parallel_each(
+				definition.sprite.size(),
+				[&] (Size const & sprite_index) {
+					auto & sprite_definition = definition.sprite[sprite_index];
+					auto & sprite = sprite_view[sprite_index];
+					auto sprite_data = FileSystem::read_file(sprite_directory / Path{sprite_definition.name + ".png"_sv});
+					auto sprite_size = Image::ImageSize{};
+					File::PNG::Read::estimate_image(sprite_data, sprite_size);
+					auto sprite_stream = IByteStreamView{sprite_data};
+					if (sprite_size == sprite_definition.size) {
+						File::PNG::Read::process_image(sprite_stream, sprite);
+					}
+					else {
+						// NOTE : the image is cropped to the sprite region, the uncovered part of the region is left untouched
+						auto sprite_image = Image::Image{sprite_size};
+						File::PNG::Read::process_image(sprite_stream, sprite_image.view());
+						auto draw_size = Image::ImageSize{minimum(sprite_size.width, sprite_definition.size.width), minimum(sprite_size.height, sprite_definition.size.height)};
+						sprite.sub(Image::k_begin_image_position, draw_size).draw(sprite_image.view().sub(Image::k_begin_image_position, draw_size));
+					}
+				}
+			);
+			return;
+		}
+
+		// ----------------
+
+		static auto process (
+			Image::VImageView const & atlas,
+			Definition::Atlas const & definition,
+			Path const &              sprite_directory
+		) -> Void {
+			return process_atlas(atlas, definition, sprite_directory);
+		}
+
+	};
+
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "kernel/utility/utility.hpp"
+
+namespace TwinStar::Kernel::Tool::Texture::Atlas {
+
+	struct Definition {
+
+		#pragma region sprite
+
+		M_record_of_map(
+			M_wrap(Sprite),
+			M_wrap(
+				(String) name,
+				(Image::ImagePosition) position,
+				(Image::ImageSize) size,
+			),
+		);
+
+		#pragma endregion
+
+		#pragma region atlas
+
+		M_record_of_map(
+			M_wrap(Atlas),
+			M_wrap(
+				(Image::ImageSize) size,
+				(List<Sprite>) sprite,
+			),
+		);
+
+		#pragma endregion
+
+	};
+
+}
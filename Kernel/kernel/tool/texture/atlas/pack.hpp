@@ -0,0 +1,231 @@
+#pragma once
+
+#include "kernel/utility/utility.hpp"
+#include "kernel/tool/texture/atlas/common.hpp"
+#include <algorithm>
+
+namespace TwinStar::Kernel::Tool::Texture::Atlas {
+
+	struct Pack :
+		Common {
+
+		using Common = Common;
+
+		// ----------------
+
+		// NOTE : MaxRects, best short side fit, rotation off
+		static auto pack_in_container (
+			Image::ImageSize const &             container,
+			CListView<Image::ImageSize> const &  item,
+			CListView<Size> const &              item_order,
+			List<Image::ImagePosition> &         item_position
+		) -> Boolean {
+			auto free_list = List<Rectangle>{};
+			free_list.append(Rectangle{.x = 0_sz, .y = 0_sz, .width = container.width, .height = container.height});
+			auto next_free_list = List<Rectangle>{};
+			auto discarded = List<Boolean>{};
+			item_position.allocate_full(item.size());
+			for (auto & item_index : item_order) {
+				auto & item_size = item[item_index];
+				if (item_size.width == 0_sz || item_size.height == 0_sz) {
+					item_position[item_index] = Image::ImagePosition{0_sz, 0_sz};
+					continue;
+				}
+				auto best_index = Optional<Size>{};
+				auto best_short_side = Size{};
+				auto best_long_side = Size{};
+				for (auto & free_index : SizeRange{free_list.size()}) {
+					auto & free = free_list[free_index];
+					if (free.width < item_size.width || free.height < item_size.height) {
+						continue;
+					}
+					auto reserve_width = free.width - item_size.width;
+					auto reserve_height = free.height - item_size.height;
+					auto short_side = minimum(reserve_width, reserve_height);
+					auto long_side = maximum(reserve_width, reserve_height);
+					if (!best_index.has() || short_side < best_short_side || (short_side == best_short_side && long_side < best_long_side)) {
+						best_index.set(free_index);
+						best_short_side = short_side;
+						best_long_side = long_side;
+					}
+				}
+				if (!best_index.has()) {
+					return k_false;
+				}
+				auto placed = Rectangle{
+					.x = free_list[best_index.get()].x,
+					.y = free_list[best_index.get()].y,
+					.width = item_size.width,
+					.height = item_size.height,
+				};
+				item_position[item_index] = Image::ImagePosition{placed.x, placed.y};
+				next_free_list.allocate(free_list.size() + 4_sz);
+				for (auto & free : free_list) {
+					if (!rectangle_intersect(free, placed)) {
+						next_free_list.append(free);
+						continue;
+					}
+					if (placed.x > free.x) {
+						next_free_list.append(Rectangle{.x = free.x, .y = free.y, .width = placed.x - free.x, .height = free.height});
+					}
+					if (placed.x + placed.width < free.x + free.width) {
+						next_free_list.append(Rectangle{.x = placed.x + placed.width, .y = free.y, .width = free.x + free.width - (placed.x + placed.width), .height = free.height});
+					}
+					if (placed.y > free.y) {
+						next_free_list.append(Rectangle{.x = free.x, .y = free.y, .width = free.width, .height = placed.y - free.y});
+					}
+					if (placed.y + placed.height < free.y + free.height) {
+						next_free_list.append(Rectangle{.x = free.x, .y = placed.y + placed.height, .width = free.width, .height = free.y + free.height - (placed.y + placed.height)});
+					}
+				}
+				discarded.allocate_full(next_free_list.size());
+				for (auto & thix_index : SizeRange{next_free_list.size()}) {
+					if (discarded[thix_index]) {
+						continue;
+					}
+					for (auto & that_index : SizeRange{next_free_list.size()}) {
+						if (thix_index == that_index || discarded[that_index]) {
+							continue;
+						}
+						if (rectangle_contain(next_free_list[that_index], next_free_list[thix_index])) {
+							discarded[thix_index] = k_true;
+							break;
+						}
+					}
+				}
+				free_list.allocate(next_free_list.size());
+				for (auto & free_index : SizeRange{next_free_list.size()}) {
+					if (!discarded[free_index]) {
+						free_list.append(next_free_list[free_index]);
+					}
+				}
+			}
+			return k_true;
+		}
+
+		// ----------------
+
+		static auto process_whole (
+			CListView<Image::ImageSize> const & item,
+			Image::ImageSize &                  container,
+			List<Image::ImagePosition> &        item_position,
+			ExpandMethod const &                expand_method,
+			Boolean const &                     expand_square,
+			Size const &                        expand_value
+		) -> Void {
+			assert_test(expand_method != ExpandMethod::Constant::fixed() || expand_value != 0_sz);
+			// NOTE : the container can not be smaller than the largest item nor the total item area, skip such step directly
+			auto minimum_width = k_none_size;
+			auto minimum_height = k_none_size;
+			auto minimum_area = k_none_size;
+			for (auto & item_size : item) {
+				minimum_width = maximum(minimum_width, item_size.width);
+				minimum_height = maximum(minimum_height, item_size.height);
+				minimum_area += item_size.area();
+			}
+			auto container_list = List<Image::ImageSize>{};
+			container_list.append(Image::ImageSize{0_sz, 0_sz});
+			while (container_list.last().width < minimum_width || container_list.last().height < minimum_height || container_list.last().area() < minimum_area) {
+				auto next_container = container_list.last();
+				expand_container(next_container, container_list.size() - 1_sz, expand_method, expand_square, expand_value);
+				container_list.append(next_container);
+			}
+			auto first_step = container_list.size() - 1_sz;
+			// NOTE : each weighter search the first step that can pack all item, steps and weighters are evaluated concurrently in wave
+			struct WeighterState {
+				List<Size>                 order;
+				Size                       next_step;
+				Optional<Size>             step;
+				List<Image::ImagePosition> position;
+			};
+			struct Task {
+				Size                       weighter;
+				Size                       step;
+				Boolean                    success;
+				List<Image::ImagePosition> position;
+			};
+			auto weighter_state = List<WeighterState>{};
+			Generalization::each<ItemWeighterPackage>(
+				[&] <auto index, auto weighter> (ValuePackage<index>, ValuePackage<weighter>) -> auto {
+					auto & state = weighter_state.append();
+					auto weight = List<Floater>{};
+					weight.allocate_full(item.size());
+					state.order.allocate_full(item.size());
+					for (auto & item_index : SizeRange{item.size()}) {
+						weight[item_index] = compute_weight(item[item_index], weighter);
+						state.order[item_index] = item_index;
+					}
+					std::stable_sort(
+						state.order.begin().value,
+						state.order.end().value,
+						[&] (Size const & thix, Size const & that) {
+							return weight[thix] > weight[that];
+						}
+					);
+					state.next_step = first_step;
+				}
+			);
+			auto thread_count = hardware_thread_count();
+			while (Range::any_of(weighter_state, [] (auto & state) { return !state.step.has(); })) {
+				auto pending_count = Range::count_if(weighter_state, [] (auto & state) { return !state.step.has(); });
+				auto wave_size = maximum((thread_count + pending_count - 1_sz) / pending_count, 1_sz);
+				auto task_list = List<Task>{};
+				for (auto & weighter_index : SizeRange{weighter_state.size()}) {
+					auto & state = weighter_state[weighter_index];
+					if (state.step.has()) {
+						continue;
+					}
+					for (auto & step_offset : SizeRange{wave_size}) {
+						task_list.append(Task{.weighter = weighter_index, .step = state.next_step + step_offset, .success = k_false, .position = {}});
+					}
+					state.next_step += wave_size;
+				}
+				for (auto & task : task_list) {
+					while (container_list.size() <= task.step) {
+						auto next_container = container_list.last();
+						expand_container(next_container, container_list.size() - 1_sz, expand_method, expand_square, expand_value);
+						container_list.append(next_container);
+					}
+				}
+				parallel_each(
+					task_list.size(),
+					[&] (Size const & task_index) {
+						auto & task = task_list[task_index];
+						task.success = pack_in_container(container_list[task.step], item, weighter_state[task.weighter].order, task.position);
+					}
+				);
+				for (auto & task : task_list) {
+					auto & state = weighter_state[task.weighter];
+					if (task.success && (!state.step.has() || task.step < state.step.get())) {
+						state.step.set(task.step);
+						state.position = as_moveable(task.position);
+					}
+				}
+			}
+			auto best_index = k_begin_index;
+			for (auto & weighter_index : SizeRange{weighter_state.size()}) {
+				if (container_list[weighter_state[weighter_index].step.get()].area() < container_list[weighter_state[best_index].step.get()].area()) {
+					best_index = weighter_index;
+				}
+			}
+			container = container_list[weighter_state[best_index].step.get()];
+			item_position = as_moveable(weighter_state[best_index].position);
+			return;
+		}
+
+		// ----------------
+
+		static auto process (
+			List<Image::ImageSize> const & item,
+			Image::ImageSize &             container,
+			List<Image::ImagePosition> &   item_position,
+			ExpandMethod const &           expand_method,
+			Boolean const &                expand_square,
+			Size const &                   expand_value
+		) -> Void {
+			return process_whole(item, container, item_position, expand_method, expand_square, expand_value);
+		}
+
+	};
+
+}
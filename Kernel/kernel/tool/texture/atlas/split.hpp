@@ -0,0 +1,87 @@
+#pragma once
+
+#include "kernel/utility/utility.hpp"
+#include "kernel/tool/texture/atlas/common.hpp"
+#include "kernel/tool/texture/atlas/definition.hpp"
+#include "kernel/tool/texture/file/png/write.hpp"
+
+namespace TwinStar::Kernel::Tool::Texture::Atlas {
+
+	struct Split :
+		Common {
+
+		using Common = Common;
+
+		// ----------------
+
+		// NOTE : shrink the region to the bounding box of non-transparent pixel, keep it unchanged if the whole region is transparent
+		static auto trim_sprite (
+			Image::CImageView const & atlas,
+			Image::ImagePosition &    position,
+			Image::ImageSize &        size
+		) -> Void {
+			auto begin_x = position.x + size.width;
+			auto begin_y = position.y + size.height;
+			auto end_x = position.x;
+			auto end_y = position.y;
+			for (auto & y : SizeRange{size.height}) {
+				auto & row = atlas[position.y + y];
+				for (auto & x : SizeRange{size.width}) {
+					if (row[position.x + x].alpha != Image::k_color_minimum) {
+						begin_x = minimum(begin_x, position.x + x);
+						begin_y = minimum(begin_y, position.y + y);
+						end_x = maximum(end_x, position.x + x + 1_sz);
+						end_y = maximum(end_y, position.y + y + 1_sz);
+					}
+				}
+			}
+			if (begin_x < end_x && begin_y < end_y) {
+				position = Image::ImagePosition{begin_x, begin_y};
+				size = Image::ImageSize{end_x - begin_x, end_y - begin_y};
+			}
+			return;
+		}
+
+		// ----------------
+
+		static auto process_atlas (
+			Image::CImageView const & atlas,
+			Definition::Atlas &       definition,
+			Path const &              sprite_directory,
+			Boolean const &           trim
+		) -> Void {
+			assert_test(atlas.size() == definition.size);
+			parallel_each(
+				definition.sprite.size(),
+				[&] (Size const & sprite_index) {
+					auto & sprite_definition = definition.sprite[sprite_index];
+					if (trim) {
+						trim_sprite(atlas, sprite_definition.position, sprite_definition.size);
+					}
+					auto atlas_view = atlas;
+					auto sprite = atlas_view.sub(sprite_definition.position, sprite_definition.size);
+					auto sprite_data_size_bound = Size{};
+					File::PNG::Write::estimate_image(sprite_definition.size, sprite_data_size_bound);
+					auto sprite_data = ByteArray{sprite_data_size_bound};
+					auto sprite_stream = OByteStreamView{sprite_data};
+					File::PNG::Write::process_image(sprite_stream, sprite, File::PNG::Effort::Constant::default_mode());
+					FileSystem::write_file(sprite_directory / Path{sprite_definition.name + ".png"_sv}, sprite_stream.stream_view());
+				}
+			);
+			return;
+		}
+
+		// ----------------
+
+		static auto process (
+			Image::CImageView const & atlas,
+			Definition::Atlas &       definition,
+			Path const &              sprite_directory,
+			Boolean const &           trim
+		) -> Void {
+			return process_atlas(atlas, definition, sprite_directory, trim);
+		}
+
+	};
+
+}
@@ -56,7 +56,10 @@ namespace TwinStar::Kernel::Tool::Texture::Compression::ETC1 {
 			Image::CImageView const & image
 		) -> Void {
 			M_use_zps_of(data);
-			return process_image(data, image);
+			auto span = TraceSpan{"texture.compression.etc1.compress"_sv};
+			process_image(data, image);
+			span.set_byte(image.size().area() * 4_sz, data.position());
+			return;
 		}
 
 	};
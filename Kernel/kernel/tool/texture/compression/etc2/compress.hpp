@@ -89,7 +89,10 @@ namespace TwinStar::Kernel::Tool::Texture::Compression::ETC2 {
 			Boolean const &           with_alpha
 		) -> Void {
 			M_use_zps_of(data);
-			return process_image(data, image, with_alpha);
+			auto span = TraceSpan{"texture.compression.etc2.compress"_sv};
+			process_image(data, image, with_alpha);
+			span.set_byte(image.size().area() * 4_sz, data.position());
+			return;
 		}
 
 	};
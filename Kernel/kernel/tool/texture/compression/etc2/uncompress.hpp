@@ -22,8 +22,8 @@ namespace TwinStar::Kernel::Tool::Texture::Compression::ETC2 {
 			auto image_block = Array<Image::Pixel>{k_block_width * k_block_width};
 			for (auto & block_y : SizeRange{image.size().height / k_block_width}) {
 				for (auto & block_x : SizeRange{image.size().width / k_block_width}) {
-					auto block_part_1 = reverse_endian(data.read_of<IntegerU32>());
-					auto block_part_2 = reverse_endian(data.read_of<IntegerU32>());
+					auto block_part_1 = as_endian_byte_stream<std::endian::big>(data).read_of<IntegerU32>();
+					auto block_part_2 = as_endian_byte_stream<std::endian::big>(data).read_of<IntegerU32>();
 					Third::ETCPACK::decompressBlockETC2c(
 						block_part_1.value,
 						block_part_2.value,
@@ -67,8 +67,8 @@ namespace TwinStar::Kernel::Tool::Texture::Compression::ETC2 {
 						4
 					);
 					data.forward(k_block_width * k_block_width * k_bpp_a / k_type_bit_count<Byte>);
-					auto block_part_1 = reverse_endian(data.read_of<IntegerU32>());
-					auto block_part_2 = reverse_endian(data.read_of<IntegerU32>());
+					auto block_part_1 = as_endian_byte_stream<std::endian::big>(data).read_of<IntegerU32>();
+					auto block_part_2 = as_endian_byte_stream<std::endian::big>(data).read_of<IntegerU32>();
 					Third::ETCPACK::decompressBlockETC2c(
 						block_part_1.value,
 						block_part_2.value,
@@ -82,7 +82,10 @@ namespace TwinStar::Kernel::Tool::Texture::Compression::PVRTC4 {
 			Boolean const &           with_alpha
 		) -> Void {
 			M_use_zps_of(data);
-			return process_image(data, image, with_alpha);
+			auto span = TraceSpan{"texture.compression.pvrtc4.compress"_sv};
+			process_image(data, image, with_alpha);
+			span.set_byte(image.size().area() * 4_sz, data.position());
+			return;
 		}
 
 	};
@@ -5,8 +5,66 @@
 
 namespace TwinStar::Kernel::Tool::Texture::File::PNG {
 
+	M_enumeration(
+		M_wrap(Effort),
+		M_wrap(
+			fast,
+			default_mode,
+			best,
+		),
+	);
+
+	// ----------------
+
 	struct Common {
 
+		using Signature = StaticByteArray<8_sz>;
+
+		inline static constexpr auto k_signature = Signature{{0x89_b, 0x50_b, 0x4E_b, 0x47_b, 0x0D_b, 0x0A_b, 0x1A_b, 0x0A_b}};
+
+		using ChunkType = StaticByteArray<4_sz>;
+
+		inline static constexpr auto k_chunk_type_header = ChunkType{{0x49_b, 0x48_b, 0x44_b, 0x52_b}};
+
+		inline static constexpr auto k_chunk_type_data = ChunkType{{0x49_b, 0x44_b, 0x41_b, 0x54_b}};
+
+		inline static constexpr auto k_chunk_type_end = ChunkType{{0x49_b, 0x45_b, 0x4E_b, 0x44_b}};
+
+		inline static constexpr auto k_chunk_type_transparency = ChunkType{{0x74_b, 0x52_b, 0x4E_b, 0x53_b}};
+
+		inline static constexpr auto k_chunk_type_background = ChunkType{{0x62_b, 0x4B_b, 0x47_b, 0x44_b}};
+
+		inline static constexpr auto k_chunk_type_gamma = ChunkType{{0x67_b, 0x41_b, 0x4D_b, 0x41_b}};
+
+		inline static constexpr auto k_chunk_type_standard_rgb = ChunkType{{0x73_b, 0x52_b, 0x47_b, 0x42_b}};
+
+		// ----------------
+
+		// NOTE : integer in png is always big-endian
+		static auto write_integer (
+			OByteStreamView &  data,
+			IntegerU32 const & value
+		) -> Void {
+			data.write(cbw<Byte>(value >> 24_sz));
+			data.write(cbw<Byte>(value >> 16_sz));
+			data.write(cbw<Byte>(value >> 8_sz));
+			data.write(cbw<Byte>(value >> 0_sz));
+			return;
+		}
+
+		static auto read_integer (
+			IByteStreamView & data
+		) -> IntegerU32 {
+			auto value = IntegerU32{};
+			value |= cbw<IntegerU32>(data.read_of<Byte>()) << 24_sz;
+			value |= cbw<IntegerU32>(data.read_of<Byte>()) << 16_sz;
+			value |= cbw<IntegerU32>(data.read_of<Byte>()) << 8_sz;
+			value |= cbw<IntegerU32>(data.read_of<Byte>()) << 0_sz;
+			return value;
+		}
+
+		// ----------------
+
 		static auto png_error (
 			Third::libpng::png_structp     png_ptr,
 			Third::libpng::png_const_charp error_message
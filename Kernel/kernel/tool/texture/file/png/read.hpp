@@ -3,6 +3,10 @@
 #include "kernel/utility/utility.hpp"
 #include "kernel/tool/texture/file/png/common.hpp"
 #include "kernel/third/libpng.hpp"
+#include "kernel/third/zlib.hpp"
+#if defined M_architecture_x86_64 || (defined M_architecture_x86_32 && (defined __SSE2__ || (defined _M_IX86_FP && _M_IX86_FP >= 2)))
+#include <emmintrin.h>
+#endif
 
 namespace TwinStar::Kernel::Tool::Texture::File::PNG {
 
@@ -13,7 +17,366 @@ namespace TwinStar::Kernel::Tool::Texture::File::PNG {
 
 		// ----------------
 
-		static auto process_image (
+		struct Information {
+			Image::ImageSize    size;
+			Size                bit_depth;
+			Size                color_type;
+			Size                interlace_method;
+			Boolean             has_transparency;
+			Boolean             has_background;
+			Boolean             gamma_is_identity;
+			List<CByteListView> data;
+		};
+
+		// ----------------
+
+		// NOTE : libpng's threshold, the correction is insignificant if file gamma * screen gamma (2.2 for sRGB) is close to 1
+		static auto gamma_is_identity (
+			Floater const & file_gamma
+		) -> Boolean {
+			auto correction = file_gamma * 2.2_f;
+			return correction > 0.95_f && correction < 1.05_f;
+		}
+
+		// NOTE : same as libpng's default, crc error in critical chunk is fatal, ancillary chunk with crc error is discarded
+		static auto parse_information (
+			IByteStreamView & data,
+			Information &     information
+		) -> Void {
+			data.read_constant(k_signature);
+			information.gamma_is_identity = k_true;
+			auto has_standard_rgb = k_false;
+			while (k_true) {
+				auto chunk_size = cbw<Size>(read_integer(data));
+				auto chunk_crc_data = data.next_view(4_sz + chunk_size);
+				auto chunk_type = data.read_of<ChunkType>();
+				auto chunk_data = IByteStreamView{data.forward_view(chunk_size)};
+				auto chunk_crc = read_integer(data);
+				if (chunk_crc != mbw<IntegerU32>(static_cast<ZIntegerU32>(Third::zlib::crc32(0, cast_pointer<Third::zlib::Bytef>(as_variable_pointer(chunk_crc_data.begin())).value, static_cast<unsigned>(chunk_crc_data.size().value))))) {
+					assert_test((cbw<IntegerU8>(chunk_type[1_ix]) & 0x20_iu8) != 0x00_iu8);
+					continue;
+				}
+				if (chunk_type == k_chunk_type_header) {
+					information.size.width = cbw<Size>(read_integer(chunk_data));
+					information.size.height = cbw<Size>(read_integer(chunk_data));
+					information.bit_depth = cbw<Size>(chunk_data.read_of<IntegerU8>());
+					information.color_type = cbw<Size>(chunk_data.read_of<IntegerU8>());
+					chunk_data.read_of<IntegerU8>();
+					chunk_data.read_of<IntegerU8>();
+					information.interlace_method = cbw<Size>(chunk_data.read_of<IntegerU8>());
+				}
+				else if (chunk_type == k_chunk_type_data) {
+					information.data.append(chunk_data.view());
+				}
+				else if (chunk_type == k_chunk_type_transparency) {
+					information.has_transparency = k_true;
+				}
+				else if (chunk_type == k_chunk_type_background) {
+					information.has_background = k_true;
+				}
+				else if (chunk_type == k_chunk_type_standard_rgb) {
+					has_standard_rgb = k_true;
+					information.gamma_is_identity = k_true;
+				}
+				else if (chunk_type == k_chunk_type_gamma) {
+					if (!has_standard_rgb) {
+						information.gamma_is_identity = gamma_is_identity(cbw<Floater>(read_integer(chunk_data)) / 100000.0_f);
+					}
+				}
+				else if (chunk_type == k_chunk_type_end) {
+					break;
+				}
+			}
+			return;
+		}
+
+		// ----------------
+
+		static auto unfilter_row_generic (
+			ZByte const &         filter,
+			ZPointer<ZByte>       current,
+			ZPointer<ZByte const> previous,
+			ZSize const &         length,
+			ZSize const &         bpp
+		) -> Void {
+			switch (filter) {
+				case 0 : {
+					break;
+				}
+				case 1 : {
+					for (auto index = bpp; index < length; ++index) {
+						current[index] = static_cast<ZByte>(current[index] + current[index - bpp]);
+					}
+					break;
+				}
+				case 2 : {
+					for (auto index = ZSize{0}; index < length; ++index) {
+						current[index] = static_cast<ZByte>(current[index] + previous[index]);
+					}
+					break;
+				}
+				case 3 : {
+					for (auto index = ZSize{0}; index < bpp; ++index) {
+						current[index] = static_cast<ZByte>(current[index] + previous[index] / 2);
+					}
+					for (auto index = bpp; index < length; ++index) {
+						current[index] = static_cast<ZByte>(current[index] + (current[index - bpp] + previous[index]) / 2);
+					}
+					break;
+				}
+				case 4 : {
+					for (auto index = ZSize{0}; index < bpp; ++index) {
+						current[index] = static_cast<ZByte>(current[index] + previous[index]);
+					}
+					for (auto index = bpp; index < length; ++index) {
+						auto a = static_cast<ZInteger>(current[index - bpp]);
+						auto b = static_cast<ZInteger>(previous[index]);
+						auto c = static_cast<ZInteger>(previous[index - bpp]);
+						auto p = a + b - c;
+						auto pa = p > a ? (p - a) : (a - p);
+						auto pb = p > b ? (p - b) : (b - p);
+						auto pc = p > c ? (p - c) : (c - p);
+						current[index] = static_cast<ZByte>(current[index] + (pa <= pb && pa <= pc ? (a) : (pb <= pc ? (b) : (c))));
+					}
+					break;
+				}
+				default : {
+					assert_fail(R"(filter == /* valid */)");
+				}
+			}
+			return;
+		}
+
+		#if defined M_architecture_x86_64 || (defined M_architecture_x86_32 && (defined __SSE2__ || (defined _M_IX86_FP && _M_IX86_FP >= 2)))
+
+		// NOTE : sse2 version for 3 or 4 byte per pixel, port of libpng's intel filter, pixel is loaded into the low lane and the unused byte stay zero
+		template <auto bpp> requires
+			CategoryConstraint<>
+			&& (IsSameV<bpp, ZSize>)
+			&& (bpp == 3 || bpp == 4)
+		static auto unfilter_row_packed (
+			ZByte const &         filter,
+			ZPointer<ZByte>       current,
+			ZPointer<ZByte const> previous,
+			ZSize const &         length
+		) -> Void {
+			auto load = [] (ZPointer<ZByte const> pointer) -> __m128i {
+				auto value = ZIntegerS32{0};
+				std::memcpy(&value, pointer, bpp);
+				return _mm_cvtsi32_si128(value);
+			};
+			auto store = [] (ZPointer<ZByte> pointer, __m128i const & vector) -> Void {
+				auto value = _mm_cvtsi128_si32(vector);
+				std::memcpy(pointer, &value, bpp);
+				return;
+			};
+			auto select = [] (__m128i const & condition, __m128i const & then, __m128i const & otherwise) -> __m128i {
+				return _mm_or_si128(_mm_and_si128(condition, then), _mm_andnot_si128(condition, otherwise));
+			};
+			auto absolute = [] (__m128i const & value) -> __m128i {
+				return _mm_max_epi16(value, _mm_sub_epi16(_mm_setzero_si128(), value));
+			};
+			switch (filter) {
+				case 0 : {
+					break;
+				}
+				case 1 : {
+					auto a = _mm_setzero_si128();
+					for (auto index = ZSize{0}; index < length; index += bpp) {
+						a = _mm_add_epi8(a, load(current + index));
+						store(current + index, a);
+					}
+					break;
+				}
+				case 2 : {
+					auto index = ZSize{0};
+					for (; index + 16 <= length; index += 16) {
+						auto value = _mm_add_epi8(_mm_loadu_si128(reinterpret_cast<ZPointer<__m128i const>>(current + index)), _mm_loadu_si128(reinterpret_cast<ZPointer<__m128i const>>(previous + index)));
+						_mm_storeu_si128(reinterpret_cast<ZPointer<__m128i>>(current + index), value);
+					}
+					for (; index < length; ++index) {
+						current[index] = static_cast<ZByte>(current[index] + previous[index]);
+					}
+					break;
+				}
+				case 3 : {
+					auto a = _mm_setzero_si128();
+					auto one = _mm_set1_epi8(1);
+					for (auto index = ZSize{0}; index < length; index += bpp) {
+						auto b = load(previous + index);
+						auto average = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+						a = _mm_add_epi8(load(current + index), average);
+						store(current + index, a);
+					}
+					break;
+				}
+				case 4 : {
+					auto zero = _mm_setzero_si128();
+					auto a = zero;
+					auto b = zero;
+					auto c = zero;
+					for (auto index = ZSize{0}; index < length; index += bpp) {
+						c = b;
+						b = _mm_unpacklo_epi8(load(previous + index), zero);
+						auto x = _mm_unpacklo_epi8(load(current + index), zero);
+						auto pa = _mm_sub_epi16(b, c);
+						auto pb = _mm_sub_epi16(a, c);
+						auto pc = _mm_add_epi16(pa, pb);
+						pa = absolute(pa);
+						pb = absolute(pb);
+						pc = absolute(pc);
+						auto smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+						auto nearest = select(_mm_cmpeq_epi16(smallest, pa), a, select(_mm_cmpeq_epi16(smallest, pb), b, c));
+						a = _mm_add_epi8(x, nearest);
+						store(current + index, _mm_packus_epi16(a, a));
+					}
+					break;
+				}
+				default : {
+					assert_fail(R"(filter == /* valid */)");
+				}
+			}
+			return;
+		}
+
+		#else
+
+		template <auto bpp> requires
+			CategoryConstraint<>
+			&& (IsSameV<bpp, ZSize>)
+			&& (bpp == 3 || bpp == 4)
+		static auto unfilter_row_packed (
+			ZByte const &         filter,
+			ZPointer<ZByte>       current,
+			ZPointer<ZByte const> previous,
+			ZSize const &         length
+		) -> Void {
+			return unfilter_row_generic(filter, current, previous, length, bpp);
+		}
+
+		#endif
+
+		// ----------------
+
+		// NOTE : 8-bit non-interlaced RGBA or RGB without tRNS, bKGD and gamma correction, inflate directly into the image row and unfilter in place
+		static auto check_direct_decodable (
+			Information const & information
+		) -> Boolean {
+			return information.bit_depth == 8_sz && (information.color_type == 6_sz || information.color_type == 2_sz) && information.interlace_method == 0_sz && !information.has_transparency && !information.has_background && information.gamma_is_identity && !information.data.empty();
+		}
+
+		static auto process_image_direct (
+			Information const &       information,
+			Image::VImageView const & image
+		) -> Void {
+			#if defined M_compiler_clang
+			#pragma clang diagnostic push
+			#pragma clang diagnostic ignored "-Wold-style-cast"
+			#endif
+			assert_test(image.size() == information.size);
+			auto is_rgba = information.color_type == 6_sz;
+			auto row_size = information.size.width * (is_rgba ? (4_sz) : (3_sz));
+			auto z_stream = Third::zlib::z_stream{
+				.next_in = nullptr,
+				.avail_in = 0,
+				.total_in = 0,
+				.next_out = nullptr,
+				.avail_out = 0,
+				.total_out = 0,
+				.msg = nullptr,
+				.state = nullptr,
+				.zalloc = nullptr,
+				.zfree = nullptr,
+				.opaque = nullptr,
+				.data_type = 0,
+				.adler = 0,
+				.reserved = 0,
+			};
+			auto state = int{};
+			state = Third::zlib::inflateInit2(
+				&z_stream,
+				Third::zlib::MAX_WBITS_
+			);
+			assert_test(state == Third::zlib::Z_OK_);
+			auto data_index = k_begin_index;
+			auto inflate_to = [&] (
+				ZPointer<ZByte> destination,
+				ZSize const &   size
+			) -> Void {
+				z_stream.next_out = destination;
+				z_stream.avail_out = static_cast<unsigned>(size);
+				while (z_stream.avail_out != 0) {
+					if (z_stream.avail_in == 0 && data_index < information.data.size()) {
+						z_stream.next_in = cast_pointer<Third::zlib::Bytef>(as_variable_pointer(information.data[data_index].begin())).value;
+						z_stream.avail_in = static_cast<unsigned>(information.data[data_index].size().value);
+						++data_index;
+						continue;
+					}
+					state = Third::zlib::inflate(
+						&z_stream,
+						Third::zlib::Z_NO_FLUSH_
+					);
+					assert_test(state == Third::zlib::Z_OK_ || (state == Third::zlib::Z_STREAM_END_ && z_stream.avail_out == 0));
+				}
+				return;
+			};
+			// NOTE : rgb row need a two-row staging buffer to keep the unfiltered previous row, the first previous row is zero
+			auto row_buffer = ByteArray{row_size * 2_sz};
+			auto zero_row = ByteArray{row_size};
+			auto previous = cast_pointer<ZByte>(zero_row.begin()).value;
+			for (auto & y : SizeRange{information.size.height}) {
+				auto filter = ZByte{};
+				inflate_to(&filter, 1);
+				if (is_rgba) {
+					auto current = reinterpret_cast<ZPointer<ZByte>>(image.data()[y].begin().value);
+					inflate_to(current, row_size.value);
+					unfilter_row_packed<ZSize{4}>(filter, current, previous, row_size.value);
+					previous = current;
+				}
+				else {
+					auto current = cast_pointer<ZByte>(row_buffer.begin() + (y % 2_sz) * row_size).value;
+					inflate_to(current, row_size.value);
+					unfilter_row_packed<ZSize{3}>(filter, current, previous, row_size.value);
+					auto destination = reinterpret_cast<ZPointer<ZByte>>(image.data()[y].begin().value);
+					for (auto x = ZSize{0}; x < information.size.width.value; ++x) {
+						destination[x * 4 + 0] = current[x * 3 + 0];
+						destination[x * 4 + 1] = current[x * 3 + 1];
+						destination[x * 4 + 2] = current[x * 3 + 2];
+						destination[x * 4 + 3] = 0xFF;
+					}
+					previous = current;
+				}
+			}
+			// NOTE : the stream must end right after the last row, inflate verify the adler32 checksum once it reach the end
+			while (state != Third::zlib::Z_STREAM_END_) {
+				if (z_stream.avail_in == 0) {
+					assert_test(data_index < information.data.size());
+					z_stream.next_in = cast_pointer<Third::zlib::Bytef>(as_variable_pointer(information.data[data_index].begin())).value;
+					z_stream.avail_in = static_cast<unsigned>(information.data[data_index].size().value);
+					++data_index;
+					continue;
+				}
+				auto overflow = ZByte{};
+				z_stream.next_out = &overflow;
+				z_stream.avail_out = 1;
+				state = Third::zlib::inflate(
+					&z_stream,
+					Third::zlib::Z_NO_FLUSH_
+				);
+				assert_test((state == Third::zlib::Z_OK_ || state == Third::zlib::Z_STREAM_END_) && z_stream.avail_out == 1);
+			}
+			Third::zlib::inflateEnd(
+				&z_stream
+			);
+			return;
+			#if defined M_compiler_clang
+			#pragma clang diagnostic pop
+			#endif
+		}
+
+		// ----------------
+
+		static auto process_image_by_library (
 			IByteStreamView &         data,
 			Image::VImageView const & image
 		) -> Void {
@@ -67,17 +430,12 @@ namespace TwinStar::Kernel::Tool::Texture::File::PNG {
 			if (Third::libpng::png_get_bKGD(png_struct, png_info, &png_background) != 0) {
 				Third::libpng::png_set_background(png_struct, png_background, Third::libpng::PNG_BACKGROUND_GAMMA_FILE_, 1, 1.0);
 			}
+			// NOTE : the screen gamma is sRGB, so sRGB file and file without gamma need no correction, skip the gamma transform in that case
 			auto png_file_srgb_intent = int{};
 			auto png_file_gamma = double{};
-			if (Third::libpng::png_get_sRGB(png_struct, png_info, &png_file_srgb_intent) != 0) {
-				Third::libpng::png_set_gamma(png_struct, Third::libpng::PNG_DEFAULT_sRGB_, Third::libpng::PNG_DEFAULT_sRGB_);
-			}
-			else if (Third::libpng::png_get_gAMA(png_struct, png_info, &png_file_gamma) != 0) {
+			if (Third::libpng::png_get_sRGB(png_struct, png_info, &png_file_srgb_intent) == 0 && Third::libpng::png_get_gAMA(png_struct, png_info, &png_file_gamma) != 0 && !gamma_is_identity(mbw<Floater>(png_file_gamma))) {
 				Third::libpng::png_set_gamma(png_struct, Third::libpng::PNG_DEFAULT_sRGB_, png_file_gamma);
 			}
-			else {
-				Third::libpng::png_set_gamma(png_struct, Third::libpng::PNG_DEFAULT_sRGB_, 0.45455);
-			}
 			for (auto & row : image.data()) {
 				Third::libpng::png_read_row(png_struct, reinterpret_cast<Third::libpng::png_bytep>(row.begin().value), nullptr);
 			}
@@ -88,6 +446,44 @@ namespace TwinStar::Kernel::Tool::Texture::File::PNG {
 
 		// ----------------
 
+		static auto process_image (
+			IByteStreamView &         data,
+			Image::VImageView const & image
+		) -> Void {
+			auto information_data = IByteStreamView{data.reserve_view()};
+			auto information = Information{};
+			parse_information(information_data, information);
+			if (check_direct_decodable(information)) {
+				process_image_direct(information, image);
+				data.forward(information_data.position());
+			}
+			else {
+				process_image_by_library(data, image);
+			}
+			return;
+		}
+
+		// NOTE : parse the header and decode the pixel in one pass, image is allocated by the header
+		static auto process_image_of (
+			IByteStreamView & data,
+			Image::Image &    image
+		) -> Void {
+			auto information_data = IByteStreamView{data.reserve_view()};
+			auto information = Information{};
+			parse_information(information_data, information);
+			image.allocate(information.size);
+			if (check_direct_decodable(information)) {
+				process_image_direct(information, image.view());
+				data.forward(information_data.position());
+			}
+			else {
+				process_image_by_library(data, image.view());
+			}
+			return;
+		}
+
+		// ----------------
+
 		static auto estimate_image (
 			CByteListView const & data,
 			Image::ImageSize &    image_size
@@ -113,6 +509,14 @@ namespace TwinStar::Kernel::Tool::Texture::File::PNG {
 			return process_image(data, image);
 		}
 
+		static auto process_of (
+			IByteStreamView & data_,
+			Image::Image &    image
+		) -> Void {
+			M_use_zps_of(data);
+			return process_image_of(data, image);
+		}
+
 		static auto estimate (
 			CByteListView const & data,
 			Image::ImageSize &    image_size
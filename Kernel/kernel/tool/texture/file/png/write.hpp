@@ -3,6 +3,7 @@
 #include "kernel/utility/utility.hpp"
 #include "kernel/tool/texture/file/png/common.hpp"
 #include "kernel/third/libpng.hpp"
+#include "kernel/third/zlib.hpp"
 
 namespace TwinStar::Kernel::Tool::Texture::File::PNG {
 
@@ -13,7 +14,103 @@ namespace TwinStar::Kernel::Tool::Texture::File::PNG {
 
 		// ----------------
 
-		static auto process_image (
+		// NOTE : raw data is deflated in part of this size concurrently, each part is primed with the tail of the previous part as dictionary
+		inline static constexpr auto k_deflate_part_size = Size{0x40000_sz};
+
+		inline static constexpr auto k_deflate_dictionary_size = Size{0x8000_sz};
+
+		// ----------------
+
+		static auto write_chunk_begin (
+			OByteStreamView & data,
+			ChunkType const & type
+		) -> Size {
+			auto position = data.position();
+			data.forward(4_sz);
+			data.write_constant(type);
+			return position;
+		}
+
+		static auto write_chunk_end (
+			OByteStreamView & data,
+			Size const &      position
+		) -> Void {
+			auto end_position = data.position();
+			auto crc = Third::zlib::crc32(0, cast_pointer<Third::zlib::Bytef>(data.view().begin() + position + 4_sz).value, static_cast<unsigned>((end_position - position - 4_sz).value));
+			data.set_position(position);
+			write_integer(data, cbw<IntegerU32>(end_position - position - 8_sz));
+			data.set_position(end_position);
+			write_integer(data, mbw<IntegerU32>(static_cast<ZIntegerU32>(crc)));
+			return;
+		}
+
+		// ----------------
+
+		// NOTE : adaptive filter, same heuristic as libpng, choose the filter that produce the minimum sum of absolute signed difference
+		// if not adaptive, the sub filter is always used
+		static auto filter_row (
+			ZByte const *   current,
+			ZByte const *   previous,
+			ZSize const &   length,
+			Boolean const & adaptive,
+			ZByte *         candidate,
+			ZByte *         destination
+		) -> Void {
+			constexpr auto bpp = ZSize{4};
+			auto best_filter = ZSize{0};
+			auto best_cost = ~ZSize{0};
+			for (auto filter = adaptive ? (ZSize{0}) : (ZSize{1}); filter < (adaptive ? (ZSize{5}) : (ZSize{2})); ++filter) {
+				auto target = candidate + filter * length;
+				auto cost = ZSize{0};
+				for (auto index = ZSize{0}; index < length; ++index) {
+					auto x = static_cast<ZInteger>(current[index]);
+					auto a = index < bpp ? (ZInteger{0}) : (static_cast<ZInteger>(current[index - bpp]));
+					auto b = previous == nullptr ? (ZInteger{0}) : (static_cast<ZInteger>(previous[index]));
+					auto c = index < bpp || previous == nullptr ? (ZInteger{0}) : (static_cast<ZInteger>(previous[index - bpp]));
+					auto predictor = ZInteger{0};
+					switch (filter) {
+						case 0 : {
+							predictor = 0;
+							break;
+						}
+						case 1 : {
+							predictor = a;
+							break;
+						}
+						case 2 : {
+							predictor = b;
+							break;
+						}
+						case 3 : {
+							predictor = (a + b) / 2;
+							break;
+						}
+						case 4 : {
+							auto p = a + b - c;
+							auto pa = p > a ? (p - a) : (a - p);
+							auto pb = p > b ? (p - b) : (b - p);
+							auto pc = p > c ? (p - c) : (c - p);
+							predictor = pa <= pb && pa <= pc ? (a) : (pb <= pc ? (b) : (c));
+							break;
+						}
+					}
+					auto value = static_cast<ZByte>(x - predictor);
+					target[index] = value;
+					cost += value < 0x80 ? (static_cast<ZSize>(value)) : (static_cast<ZSize>(0x100 - value));
+				}
+				if (cost < best_cost) {
+					best_filter = filter;
+					best_cost = cost;
+				}
+			}
+			destination[0] = static_cast<ZByte>(best_filter);
+			std::memcpy(destination + 1, candidate + best_filter * length, length);
+			return;
+		}
+
+		// ----------------
+
+		static auto process_image_by_library (
 			OByteStreamView &         data,
 			Image::CImageView const & image
 		) -> Void {
@@ -31,14 +128,205 @@ namespace TwinStar::Kernel::Tool::Texture::File::PNG {
 			return;
 		}
 
+		// NOTE : fast use the sub filter and level 1, best use the adaptive filter and level 9
+		static auto process_image_by_parallel_deflate (
+			OByteStreamView &         data,
+			Image::CImageView const & image,
+			Effort const &            effort
+		) -> Void {
+			#if defined M_compiler_clang
+			#pragma clang diagnostic push
+			#pragma clang diagnostic ignored "-Wold-style-cast"
+			#endif
+			assert_test(effort == Effort::Constant::fast() || effort == Effort::Constant::best());
+			auto adaptive_filter = effort == Effort::Constant::best();
+			auto compression_level = effort == Effort::Constant::best() ? (Third::zlib::Z_BEST_COMPRESSION_) : (Third::zlib::Z_BEST_SPEED_);
+			auto row_size = image.size().width * 4_sz;
+			auto raw_data = ByteArray{(row_size + 1_sz) * image.size().height};
+			// NOTE : filter of each row only depend on the unfiltered previous row, so row are filtered concurrently in band
+			{
+				auto band_size = 64_sz;
+				auto band_count = (image.size().height + band_size - 1_sz) / band_size;
+				parallel_each(
+					band_count,
+					[&] (Size const & band_index) {
+						auto candidate = ByteArray{row_size * 5_sz};
+						auto begin_y = band_index * band_size;
+						auto end_y = minimum(begin_y + band_size, image.size().height);
+						for (auto y = begin_y; y < end_y; ++y) {
+							filter_row(
+								reinterpret_cast<ZByte const *>(image.data()[y].begin().value),
+								y == 0_sz ? (nullptr) : (reinterpret_cast<ZByte const *>(image.data()[y - 1_sz].begin().value)),
+								row_size.value,
+								adaptive_filter,
+								cast_pointer<ZByte>(candidate.begin()).value,
+								cast_pointer<ZByte>(raw_data.begin() + y * (row_size + 1_sz)).value
+							);
+						}
+					}
+				);
+			}
+			struct Part {
+				ByteArray  data;
+				Size       size;
+				IntegerU32 adler;
+			};
+			auto part_count = maximum((raw_data.size() + k_deflate_part_size - 1_sz) / k_deflate_part_size, 1_sz);
+			auto part_list = List<Part>{};
+			part_list.allocate_full(part_count);
+			parallel_each(
+				part_count,
+				[&] (Size const & part_index) {
+					auto & part = part_list[part_index];
+					auto raw_begin = part_index * k_deflate_part_size;
+					auto raw_size = minimum(k_deflate_part_size, raw_data.size() - raw_begin);
+					auto is_last = part_index == part_count - 1_sz;
+					auto z_stream = Third::zlib::z_stream{
+						.next_in = nullptr,
+						.avail_in = 0,
+						.total_in = 0,
+						.next_out = nullptr,
+						.avail_out = 0,
+						.total_out = 0,
+						.msg = nullptr,
+						.state = nullptr,
+						.zalloc = nullptr,
+						.zfree = nullptr,
+						.opaque = nullptr,
+						.data_type = 0,
+						.adler = 0,
+						.reserved = 0,
+					};
+					auto state = int{};
+					state = Third::zlib::deflateInit2(
+						&z_stream,
+						compression_level,
+						Third::zlib::Z_DEFLATED_,
+						-Third::zlib::MAX_WBITS_,
+						Third::zlib::MAX_MEM_LEVEL_,
+						Third::zlib::Z_FILTERED_
+					);
+					assert_test(state == Third::zlib::Z_OK_);
+					if (raw_begin != 0_sz) {
+						auto dictionary_size = minimum(k_deflate_dictionary_size, raw_begin);
+						state = Third::zlib::deflateSetDictionary(
+							&z_stream,
+							cast_pointer<Third::zlib::Bytef>(raw_data.begin() + raw_begin - dictionary_size).value,
+							static_cast<unsigned>(dictionary_size.value)
+						);
+						assert_test(state == Third::zlib::Z_OK_);
+					}
+					// NOTE : sync flush end the part at byte boundary without final block, so parts can be concatenated directly
+					part.data.allocate(mbw<Size>(Third::zlib::deflateBound(&z_stream, static_cast<unsigned long>(raw_size.value))) + 16_sz);
+					z_stream.next_in = cast_pointer<Third::zlib::Bytef>(raw_data.begin() + raw_begin).value;
+					z_stream.avail_in = static_cast<unsigned>(raw_size.value);
+					z_stream.next_out = cast_pointer<Third::zlib::Bytef>(part.data.begin()).value;
+					z_stream.avail_out = static_cast<unsigned>(part.data.size().value);
+					state = Third::zlib::deflate(
+						&z_stream,
+						is_last ? (Third::zlib::Z_FINISH_) : (Third::zlib::Z_SYNC_FLUSH_)
+					);
+					assert_test(state == (is_last ? (Third::zlib::Z_STREAM_END_) : (Third::zlib::Z_OK_)));
+					assert_test(z_stream.avail_in == 0 && z_stream.avail_out != 0);
+					// NOTE : deflateEnd report Z_DATA_ERROR for unfinished stream, it is expected for non-last part
+					Third::zlib::deflateEnd(
+						&z_stream
+					);
+					part.size = mbw<Size>(z_stream.total_out);
+					part.adler = mbw<IntegerU32>(static_cast<ZIntegerU32>(Third::zlib::adler32(1, cast_pointer<Third::zlib::Bytef>(raw_data.begin() + raw_begin).value, static_cast<unsigned>(raw_size.value))));
+				}
+			);
+			data.write_constant(k_signature);
+			{
+				auto position = write_chunk_begin(data, k_chunk_type_header);
+				write_integer(data, cbw<IntegerU32>(image.size().width));
+				write_integer(data, cbw<IntegerU32>(image.size().height));
+				// NOTE : bit depth, color type rgba, compression method, filter method, interlace none
+				data.write(cbw<Byte>(k_type_bit_count<Image::Color>));
+				data.write(0x06_b);
+				data.write(0x00_b);
+				data.write(0x00_b);
+				data.write(0x00_b);
+				write_chunk_end(data, position);
+			}
+			{
+				auto position = write_chunk_begin(data, k_chunk_type_data);
+				// NOTE : zlib header, deflate with 32K window, the level hint is fastest or maximum compression
+				data.write(0x78_b);
+				data.write(effort == Effort::Constant::best() ? (0xDA_b) : (0x01_b));
+				auto adler = part_list.first().adler;
+				for (auto & part_index : SizeRange{part_count}) {
+					auto & part = part_list[part_index];
+					data.write(part.data.head(part.size));
+					if (part_index != k_begin_index) {
+						adler = mbw<IntegerU32>(static_cast<ZIntegerU32>(Third::zlib::adler32_combine(adler.value, part.adler.value, static_cast<long>(minimum(k_deflate_part_size, raw_data.size() - part_index * k_deflate_part_size).value))));
+					}
+				}
+				write_integer(data, adler);
+				write_chunk_end(data, position);
+			}
+			{
+				auto position = write_chunk_begin(data, k_chunk_type_end);
+				write_chunk_end(data, position);
+			}
+			return;
+			#if defined M_compiler_clang
+			#pragma clang diagnostic pop
+			#endif
+		}
+
+		// ----------------
+
+		static auto process_image (
+			OByteStreamView &         data,
+			Image::CImageView const & image,
+			Effort const &            effort
+		) -> Void {
+			switch (effort.value) {
+				case Effort::Constant::default_mode().value : {
+					process_image_by_library(data, image);
+					break;
+				}
+				case Effort::Constant::fast().value :
+				case Effort::Constant::best().value : {
+					process_image_by_parallel_deflate(data, image, effort);
+					break;
+				}
+			}
+			return;
+		}
+
+		// ----------------
+
+		static auto estimate_image (
+			Image::ImageSize const & image_size,
+			Size &                   data_size_bound
+		) -> Void {
+			// NOTE : each row is prefixed by a filter byte, the deflate bound is the same as zlib's compressBound, IDAT is flushed every 8192 bytes by libpng
+			auto raw_size = (image_size.width * 4_sz + 1_sz) * image_size.height;
+			auto compressed_size_bound = raw_size + (raw_size >> 12_sz) + (raw_size >> 14_sz) + (raw_size >> 25_sz) + 13_sz + 6_sz;
+			auto chunk_count_bound = compressed_size_bound / 8192_sz + 1_sz;
+			data_size_bound = 8_sz + (12_sz + 13_sz) + chunk_count_bound * 12_sz + compressed_size_bound + 12_sz;
+			return;
+		}
+
 		// ----------------
 
 		static auto process (
 			OByteStreamView &         data_,
-			Image::CImageView const & image
+			Image::CImageView const & image,
+			Effort const &            effort
 		) -> Void {
 			M_use_zps_of(data);
-			return process_image(data, image);
+			return process_image(data, image, effort);
+		}
+
+		static auto estimate (
+			Image::ImageSize const & image_size,
+			Size &                   data_size_bound
+		) -> Void {
+			restruct(data_size_bound);
+			return estimate_image(image_size, data_size_bound);
 		}
 
 	};
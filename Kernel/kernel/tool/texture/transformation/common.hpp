@@ -4,6 +4,17 @@
 
 namespace TwinStar::Kernel::Tool::Texture::Transformation {
 
+	M_enumeration(
+		M_wrap(ScaleMethod),
+		M_wrap(
+			avir,
+			bilinear,
+			box,
+		),
+	);
+
+	// ----------------
+
 	struct Common {
 
 	};
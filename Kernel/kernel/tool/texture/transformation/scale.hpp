@@ -13,7 +13,72 @@ namespace TwinStar::Kernel::Tool::Texture::Transformation {
 
 		// ----------------
 
-		static auto process_image (
+		// NOTE : avir split the scanline into workload, the calling thread process the first one, others run on this pool
+		class ResizerThreadPool :
+			public Third::avir::CImageResizerThreadPool {
+
+		protected:
+
+			List<Pointer<Third::avir::CImageResizerThreadPool::CWorkload>> m_workload{};
+
+			List<Thread> m_thread{};
+
+		public:
+
+			auto getSuggestedWorkloadCount (
+			) const -> int override {
+				return static_cast<int>(hardware_thread_count().value);
+			}
+
+			auto addWorkload (
+				Third::avir::CImageResizerThreadPool::CWorkload * const workload
+			) -> void override {
+				thiz.m_workload.append(make_pointer(workload));
+				return;
+			}
+
+			auto startAllWorkloads (
+			) -> void override {
+				thiz.m_thread.allocate_full(thiz.m_workload.size());
+				for (auto & index : SizeRange{thiz.m_workload.size()}) {
+					auto workload = thiz.m_workload[index];
+					thiz.m_thread[index].run(
+						[workload] () -> Void {
+							(*workload).process();
+							return;
+						}
+					);
+				}
+				return;
+			}
+
+			auto waitAllWorkloadsToFinish (
+			) -> void override {
+				for (auto & thread : thiz.m_thread) {
+					thread.join();
+				}
+				thiz.m_thread.reset();
+				return;
+			}
+
+			auto removeAllWorkloads (
+			) -> void override {
+				thiz.m_workload.reset();
+				return;
+			}
+
+		};
+
+		// NOTE : the resizer build its fixed filter bank on construction, it is immutable after that, so one instance is shared by every call
+		static auto get_resizer (
+		) -> Third::avir::CImageResizer<> const & {
+			static auto const resizer = Third::avir::CImageResizer<>{8};
+			return resizer;
+		}
+
+		// ----------------
+
+		static auto process_image_avir (
 			Image::CImageView const & source,
 			Image::VImageView const & destination
 		) -> Void {
@@ -22,7 +87,10 @@ namespace TwinStar::Kernel::Tool::Texture::Transformation {
 			for (auto & row : SizeRange{source.size().height}) {
 				Range::assign_from(source_buffer.sub(source.size().width * row, source.size().width), source[row]);
 			}
-			Third::avir::CImageResizer<>{8}.resizeImage(
+			auto thread_pool = ResizerThreadPool{};
+			auto resizer_variable = Third::avir::CImageResizerVars{};
+			resizer_variable.ThreadPool = &thread_pool;
+			get_resizer().resizeImage(
 				cast_pointer<std::uint8_t>(source_buffer.begin()).value,
 				static_cast<int>(source.size().width.value),
 				static_cast<int>(source.size().height.value),
@@ -32,7 +100,7 @@ namespace TwinStar::Kernel::Tool::Texture::Transformation {
 				static_cast<int>(destination.size().height.value),
 				4,
 				0.0,
-				nullptr
+				&resizer_variable
 			);
 			for (auto & row : SizeRange{destination.size().height}) {
 				Range::assign_from(destination[row], destination_buffer.sub(destination.size().width * row, destination.size().width));
@@ -40,13 +108,156 @@ namespace TwinStar::Kernel::Tool::Texture::Transformation {
 			return;
 		}
 
+		static auto process_image_bilinear (
+			Image::CImageView const & source,
+			Image::VImageView const & destination
+		) -> Void {
+			if (source.size().area() == 0_sz) {
+				destination.fill(Image::Pixel{});
+				return;
+			}
+			auto scale_x = cbw<Floater>(source.size().width) / cbw<Floater>(destination.size().width);
+			auto scale_y = cbw<Floater>(source.size().height) / cbw<Floater>(destination.size().height);
+			auto sample = [] (
+				Floater const & position,
+				Size const &    limit,
+				Size &          begin,
+				Size &          end,
+				Floater &       weight
+			) -> Void {
+				auto clamped = minimum(maximum(position, 0.0_f), cbw<Floater>(limit - 1_sz));
+				begin = Math::floor<Size>(clamped);
+				end = minimum(begin + 1_sz, limit - 1_sz);
+				weight = clamped - cbw<Floater>(begin);
+				return;
+			};
+			parallel_each(
+				destination.size().height,
+				[&] (Size const & y) {
+					auto source_y_begin = Size{};
+					auto source_y_end = Size{};
+					auto weight_y = Floater{};
+					sample((cbw<Floater>(y) + 0.5_f) * scale_y - 0.5_f, source.size().height, source_y_begin, source_y_end, weight_y);
+					auto & source_row_begin = source[source_y_begin];
+					auto & source_row_end = source[source_y_end];
+					auto & destination_row = destination[y];
+					for (auto & x : SizeRange{destination.size().width}) {
+						auto source_x_begin = Size{};
+						auto source_x_end = Size{};
+						auto weight_x = Floater{};
+						sample((cbw<Floater>(x) + 0.5_f) * scale_x - 0.5_f, source.size().width, source_x_begin, source_x_end, weight_x);
+						auto blend = [&] (
+							Image::Color const & top_left,
+							Image::Color const & top_right,
+							Image::Color const & bottom_left,
+							Image::Color const & bottom_right
+						) -> Image::Color {
+							auto top = cbw<Floater>(top_left) * (1.0_f - weight_x) + cbw<Floater>(top_right) * weight_x;
+							auto bottom = cbw<Floater>(bottom_left) * (1.0_f - weight_x) + cbw<Floater>(bottom_right) * weight_x;
+							return Math::round<Image::Color>(top * (1.0_f - weight_y) + bottom * weight_y);
+						};
+						auto & top_left = source_row_begin[source_x_begin];
+						auto & top_right = source_row_begin[source_x_end];
+						auto & bottom_left = source_row_end[source_x_begin];
+						auto & bottom_right = source_row_end[source_x_end];
+						destination_row[x].red = blend(top_left.red, top_right.red, bottom_left.red, bottom_right.red);
+						destination_row[x].green = blend(top_left.green, top_right.green, bottom_left.green, bottom_right.green);
+						destination_row[x].blue = blend(top_left.blue, top_right.blue, bottom_left.blue, bottom_right.blue);
+						destination_row[x].alpha = blend(top_left.alpha, top_right.alpha, bottom_left.alpha, bottom_right.alpha);
+					}
+				}
+			);
+			return;
+		}
+
+		// NOTE : every destination pixel is the average of the source pixel it cover, exact for integral ratio such as mipmap
+		static auto process_image_box (
+			Image::CImageView const & source,
+			Image::VImageView const & destination
+		) -> Void {
+			if (source.size().area() == 0_sz) {
+				destination.fill(Image::Pixel{});
+				return;
+			}
+			auto cover = [] (
+				Size const & index,
+				Size const & source_size,
+				Size const & destination_size,
+				Size &       begin,
+				Size &       end
+			) -> Void {
+				begin = minimum(index * source_size / destination_size, source_size - 1_sz);
+				end = maximum(((index + 1_sz) * source_size + destination_size - 1_sz) / destination_size, begin + 1_sz);
+				return;
+			};
+			parallel_each(
+				destination.size().height,
+				[&] (Size const & y) {
+					auto source_y_begin = Size{};
+					auto source_y_end = Size{};
+					cover(y, source.size().height, destination.size().height, source_y_begin, source_y_end);
+					auto & destination_row = destination[y];
+					for (auto & x : SizeRange{destination.size().width}) {
+						auto source_x_begin = Size{};
+						auto source_x_end = Size{};
+						cover(x, source.size().width, destination.size().width, source_x_begin, source_x_end);
+						auto red = k_none_size;
+						auto green = k_none_size;
+						auto blue = k_none_size;
+						auto alpha = k_none_size;
+						for (auto source_y = source_y_begin; source_y < source_y_end; ++source_y) {
+							auto & source_row = source[source_y];
+							for (auto source_x = source_x_begin; source_x < source_x_end; ++source_x) {
+								auto & pixel = source_row[source_x];
+								red += cbw<Size>(pixel.red);
+								green += cbw<Size>(pixel.green);
+								blue += cbw<Size>(pixel.blue);
+								alpha += cbw<Size>(pixel.alpha);
+							}
+						}
+						auto count = (source_y_end - source_y_begin) * (source_x_end - source_x_begin);
+						destination_row[x].red = cbw<Image::Color>((red + count / 2_sz) / count);
+						destination_row[x].green = cbw<Image::Color>((green + count / 2_sz) / count);
+						destination_row[x].blue = cbw<Image::Color>((blue + count / 2_sz) / count);
+						destination_row[x].alpha = cbw<Image::Color>((alpha + count / 2_sz) / count);
+					}
+				}
+			);
+			return;
+		}
+
+		// ----------------
+
+		static auto process_image (
+			Image::CImageView const & source,
+			Image::VImageView const & destination,
+			ScaleMethod const &       method
+		) -> Void {
+			switch (method.value) {
+				case ScaleMethod::Constant::avir().value : {
+					process_image_avir(source, destination);
+					break;
+				}
+				case ScaleMethod::Constant::bilinear().value : {
+					process_image_bilinear(source, destination);
+					break;
+				}
+				case ScaleMethod::Constant::box().value : {
+					process_image_box(source, destination);
+					break;
+				}
+			}
+			return;
+		}
+
 		// ----------------
 
 		static auto process (
 			Image::CImageView const & source,
-			Image::VImageView const & destination
+			Image::VImageView const & destination,
+			ScaleMethod const &       method
 		) -> Void {
-			return process_image(source, destination);
+			return process_image(source, destination, method);
 		}
 
 	};
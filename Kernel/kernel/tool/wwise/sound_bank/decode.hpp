@@ -5199,7 +5199,10 @@ namespace TwinStar::Kernel::Tool::Wwise::SoundBank {
 		) -> Void {
 			M_use_zps_of(data);
 			restruct(definition);
-			return process_whole(data, definition, embedded_media_directory);
+			auto span = TraceSpan{"wwise.sound_bank.decode"_sv};
+			process_whole(data, definition, embedded_media_directory);
+			span.set_byte(data.position(), k_none_size);
+			return;
 		}
 
 	};
@@ -365,7 +365,7 @@ namespace TwinStar::Kernel {
 		auto reset (
 		) -> Void {
 			if (thiz.m_data != k_null_pointer) {
-				free_instance_array(thiz.m_data);
+				free_instance_array(thiz.m_data, thiz.m_size);
 			}
 			thiz.m_size = k_none_size;
 			return;
@@ -499,4 +499,11 @@ namespace TwinStar::Kernel {
 
 	#pragma endregion
 
+	#pragma region trait
+
+	template <typename Element>
+	inline constexpr auto Trait::k_trivially_relocatable<Array<Element>> = bool{true};
+
+	#pragma endregion
+
 }
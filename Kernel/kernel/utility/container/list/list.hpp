@@ -102,7 +102,7 @@ namespace TwinStar::Kernel {
 		auto operator = (
 			List && that
 		) -> List & {
-			thiz.bind(that);
+			thiz.bind(that.begin(), that.size(), that.capacity());
 			that.unbind();
 			return thiz;
 		}
@@ -427,7 +427,7 @@ namespace TwinStar::Kernel {
 		auto reset (
 		) -> Void {
 			if (thiz.m_data != k_null_pointer) {
-				free_instance_array(thiz.m_data);
+				free_instance_array(thiz.m_data, thiz.m_capacity);
 			}
 			thiz.m_size = k_none_size;
 			thiz.m_capacity = k_none_size;
@@ -457,12 +457,20 @@ namespace TwinStar::Kernel {
 		auto allocate_retain (
 			Size const & capacity
 		) -> Void {
-			auto old = as_moveable(thiz);
-			auto old_size = minimum(capacity, old.size());
-			thiz.allocate(capacity);
-			thiz.set_size(old_size);
-			Range::assign_from(thiz, make_moveable_range_of(old.head(old_size)));
-			old.reset();
+			if constexpr (IsDefaultConstructible<Element> && IsMoveConstructible<Element>) {
+				auto retain_size = minimum(capacity, thiz.size());
+				reallocate_instance_array(thiz.m_data, thiz.m_capacity, retain_size, capacity);
+				thiz.m_size = retain_size;
+				thiz.m_capacity = capacity;
+			}
+			else {
+				auto old = as_moveable(thiz);
+				auto old_size = minimum(capacity, old.size());
+				thiz.allocate(capacity);
+				thiz.set_size(old_size);
+				Range::assign_from(thiz, make_moveable_range_of(old.head(old_size)));
+				old.reset();
+			}
 			return;
 		}
 
@@ -638,7 +646,7 @@ namespace TwinStar::Kernel {
 			if (index >= thiz.end_index()) {
 				auto new_size = index + k_next_index;
 				if (new_size > thiz.capacity()) {
-					thiz.allocate_retain(new_size);
+					thiz.allocate_retain(maximum(new_size, thiz.capacity() * 2_sz));
 				}
 				thiz.set_size(new_size);
 			}
@@ -670,13 +678,22 @@ namespace TwinStar::Kernel {
 		) -> Void {
 			assert_test(position <= thiz.end_index());
 			if (size > thiz.reserve()) {
-				thiz.allocate_retain(size > thiz.reserve() ? ((thiz.size() + size) * 2_sz) : (thiz.capacity()));
+				thiz.allocate_retain(maximum(thiz.size() + size, thiz.capacity() * 2_sz));
 			}
 			auto shift_begin = thiz.end_index();
 			auto shift_count = thiz.end_index() - position;
 			thiz.m_size += size;
 			if (shift_count != k_none_size) {
-				Range::assign_from(make_reverse_range_n(thiz.end(), shift_count), make_moveable_range_of(make_reverse_range_n(thiz.iterator(shift_begin), shift_count)));
+				if constexpr (IsTriviallyRelocatable<Element>) {
+					// NOTE : destruct the space slot at the tail, relocate the shifted element as byte, then construct the gap
+					std::destroy_n(thiz.iterator(shift_begin).value, size.value);
+					auto gap = thiz.iterator(position).value;
+					std::memmove(static_cast<ZPointer<void>>(gap + size.value), static_cast<ZPointer<void const>>(gap), sizeof(Element) * shift_count.value);
+					std::uninitialized_value_construct_n(gap, size.value);
+				}
+				else {
+					Range::assign_from(make_reverse_range_n(thiz.end(), shift_count), make_moveable_range_of(make_reverse_range_n(thiz.iterator(shift_begin), shift_count)));
+				}
 			}
 			return;
 		}
@@ -708,4 +725,11 @@ namespace TwinStar::Kernel {
 
 	#pragma endregion
 
+	#pragma region trait
+
+	template <typename Element>
+	inline constexpr auto Trait::k_trivially_relocatable<List<Element>> = bool{true};
+
+	#pragma endregion
+
 }
@@ -460,4 +460,11 @@ namespace TwinStar::Kernel {
 
 	#pragma endregion
 
+	#pragma region trait
+
+	template <typename Key, typename Value>
+	inline constexpr auto Trait::k_trivially_relocatable<Map<Key, Value>> = bool{true};
+
+	#pragma endregion
+
 }
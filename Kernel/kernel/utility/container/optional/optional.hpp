@@ -142,4 +142,11 @@ namespace TwinStar::Kernel {
 
 	#pragma endregion
 
+	#pragma region trait
+
+	template <typename Value>
+	inline constexpr auto Trait::k_trivially_relocatable<Optional<Value>> = Trait::k_trivially_relocatable<Value>;
+
+	#pragma endregion
+
 }
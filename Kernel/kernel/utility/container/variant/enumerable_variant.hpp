@@ -131,4 +131,11 @@ namespace TwinStar::Kernel {
 
 	#pragma endregion
 
+	#pragma region trait
+
+	template <typename Enumeration, typename ... Value>
+	inline constexpr auto Trait::k_trivially_relocatable<EnumerableVariant<Enumeration, Value ...>> = (Trait::k_trivially_relocatable<Value> && ...);
+
+	#pragma endregion
+
 }
@@ -202,4 +202,11 @@ namespace TwinStar::Kernel {
 
 	#pragma endregion
 
+	#pragma region trait
+
+	template <typename ... Value>
+	inline constexpr auto Trait::k_trivially_relocatable<Variant<Value ...>> = (Trait::k_trivially_relocatable<Value> && ...);
+
+	#pragma endregion
+
 }
@@ -340,3 +340,14 @@ namespace TwinStar::Kernel::JSON {
 	#pragma endregion
 
 }
+
+namespace TwinStar::Kernel {
+
+	#pragma region trait
+
+	template <>
+	inline constexpr auto Trait::k_trivially_relocatable<JSON::Value> = bool{true};
+
+	#pragma endregion
+
+}
@@ -145,6 +145,23 @@ namespace TwinStar::Kernel::FileSystem {
 
 			#pragma endregion
 
+			#pragma region position
+
+			auto seek (
+				Size const & offset
+			) -> Void {
+				#if defined M_system_windows
+				auto state = _fseeki64(thiz.m_value.value, static_cast<__int64>(offset.value), SEEK_SET);
+				#endif
+				#if defined M_system_linux || defined M_system_macintosh || defined M_system_android || defined M_system_iphone
+				auto state = fseeko(thiz.m_value.value, static_cast<off_t>(offset.value), SEEK_SET);
+				#endif
+				assert_test(state == 0);
+				return;
+			}
+
+			#pragma endregion
+
 		public:
 
 			#pragma region open
@@ -482,6 +499,33 @@ namespace TwinStar::Kernel::FileSystem {
 		return data;
 	}
 
+	inline auto read_file_part (
+		Path const & target,
+		Size const & offset,
+		Size const & size
+	) -> ByteArray {
+		auto data = ByteArray{size};
+		auto handler = Detail::FileHandler::open_by_read(target);
+		handler.seek(offset);
+		auto count = std::fread(data.begin().value, size.value, 1, handler.value());
+		assert_test(count == 1 || size == k_none_size);
+		return data;
+	}
+
+	// NOTE : overwrite part of an existing file, the file is extended if the part exceed the end
+	inline auto write_file_part (
+		Path const &          target,
+		Size const &          offset,
+		CByteListView const & data
+	) -> Void {
+		auto size = data.size();
+		auto handler = Detail::FileHandler::open(target, "r+b");
+		handler.seek(offset);
+		auto count = std::fwrite(data.begin().value, size.value, 1, handler.value());
+		assert_test(count == 1 || size == k_none_size);
+		return;
+	}
+
 	inline auto write_file (
 		Path const &          target,
 		CByteListView const & data
@@ -520,6 +564,58 @@ namespace TwinStar::Kernel::FileSystem {
 		return size;
 	}
 
+	// ----------------
+
+	// NOTE : read the file block by block and call executor(block) for each one, the block view is only valid inside the call
+	template <typename Executor> requires
+		CategoryConstraint<IsPureInstance<Executor>>
+		&& (IsGenericCallable<Executor>)
+	inline auto read_block_file (
+		Path const &     target,
+		Size const &     block_size,
+		Executor const & executor
+	) -> Size {
+		assert_test(block_size != k_none_size);
+		auto handler = Detail::FileHandler::open_by_read(target);
+		auto block = ByteArray{block_size};
+		auto size = k_none_size;
+		while (k_true) {
+			auto count = mbw<Size>(std::fread(block.begin().value, 1, block_size.value, handler.value()));
+			if (count != k_none_size) {
+				executor(CByteListView{block.head(count)});
+				size += count;
+			}
+			if (count != block_size) {
+				assert_test(std::ferror(handler.value()) == 0);
+				break;
+			}
+		}
+		return size;
+	}
+
+	// NOTE : create the file and call executor(writer), writer(offset, data) overwrite part of the file through one handle, the file is extended if the part exceed the end
+	template <typename Executor> requires
+		CategoryConstraint<IsPureInstance<Executor>>
+		&& (IsGenericCallable<Executor>)
+	inline auto write_block_file (
+		Path const &     target,
+		Executor const & executor
+	) -> Void {
+		auto handler = Detail::FileHandler::open_by_write(target);
+		executor(
+			[&] (
+				Size const &          offset,
+				CByteListView const & data
+			) -> Void {
+				handler.seek(offset);
+				auto count = std::fwrite(data.begin().value, data.size().value, 1, handler.value());
+				assert_test(count == 1 || data.size() == k_none_size);
+				return;
+			}
+		);
+		return;
+	}
+
 	#pragma endregion
 
 	#pragma region directory
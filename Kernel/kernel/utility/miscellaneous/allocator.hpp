@@ -2,9 +2,346 @@
 
 #include "kernel/utility/base_wrapper/wrapper.hpp"
 #include "kernel/utility/range/algorithm.hpp"
+#include "kernel/utility/null.hpp"
+#include <new>
+#include <memory>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
 
 namespace TwinStar::Kernel {
 
+	#pragma region arena
+
+	// NOTE
+	// address range of every live arena chunk in the process, so the owner of a storage is known whatever arena is bound when it is freed
+	// the lookup is skipped by one relaxed atomic load while no chunk is alive
+	class ArenaChunkRegistry {
+
+	protected:
+
+		std::atomic<ZSize> m_count;
+
+		std::map<std::uintptr_t, std::uintptr_t> m_range;
+
+		std::shared_mutex m_mutex;
+
+	public:
+
+		#pragma region structor
+
+		~ArenaChunkRegistry (
+		) = default;
+
+		// ----------------
+
+		ArenaChunkRegistry (
+		) :
+			m_count{0},
+			m_range{},
+			m_mutex{} {
+		}
+
+		ArenaChunkRegistry (
+			ArenaChunkRegistry const & that
+		) = delete;
+
+		ArenaChunkRegistry (
+			ArenaChunkRegistry && that
+		) = delete;
+
+		#pragma endregion
+
+		#pragma region operator
+
+		auto operator = (
+			ArenaChunkRegistry const & that
+		) -> ArenaChunkRegistry & = delete;
+
+		auto operator = (
+			ArenaChunkRegistry && that
+		) -> ArenaChunkRegistry & = delete;
+
+		#pragma endregion
+
+		#pragma region access
+
+		auto insert (
+			ZPointer<void const> begin,
+			ZSize const &        size
+		) -> Void {
+			auto lock = std::unique_lock<std::shared_mutex>{thiz.m_mutex};
+			thiz.m_range.emplace(reinterpret_cast<std::uintptr_t>(begin), reinterpret_cast<std::uintptr_t>(begin) + size);
+			thiz.m_count.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		auto remove (
+			ZPointer<void const> begin
+		) -> Void {
+			auto lock = std::unique_lock<std::shared_mutex>{thiz.m_mutex};
+			thiz.m_range.erase(reinterpret_cast<std::uintptr_t>(begin));
+			thiz.m_count.fetch_sub(1, std::memory_order_relaxed);
+			return;
+		}
+
+		auto contains (
+			ZPointer<void const> pointer
+		) -> Boolean {
+			if (thiz.m_count.load(std::memory_order_relaxed) == 0) {
+				return k_false;
+			}
+			auto address = reinterpret_cast<std::uintptr_t>(pointer);
+			auto lock = std::shared_lock<std::shared_mutex>{thiz.m_mutex};
+			auto range = thiz.m_range.upper_bound(address);
+			if (range == thiz.m_range.begin()) {
+				return k_false;
+			}
+			--range;
+			return mbw<Boolean>(address < range->second);
+		}
+
+		#pragma endregion
+
+	};
+
+	inline auto g_arena_chunk_registry = ArenaChunkRegistry{};
+
+	// ----------------
+
+	// NOTE
+	// monotonic arena, memory is handed out by bumping a pointer inside a chunk, and only given back all at once by reset or destruction
+	// bound to the current thread by ArenaScope, every instance array ( the storage of List, String, Array, JSON::Value ... ) allocated in the scope take memory from it
+	// anything allocated from the arena must be destroyed before the arena is reset or destroyed, so the scope should only cover data that die with the arena
+	// every chunk is recorded in g_arena_chunk_registry, so the source of an instance array is known by the chunk that own it
+	class Arena {
+
+	public:
+
+		inline static constexpr auto k_block_alignment = Size{16_sz};
+
+		inline static constexpr auto k_default_chunk_size = Size{0x10000_sz};
+
+		inline static constexpr auto k_maximum_chunk_size = Size{0x1000000_sz};
+
+	protected:
+
+		struct alignas(k_block_alignment.value) Chunk {
+			ZPointer<Chunk> next;
+			ZSize           capacity;
+		};
+
+		// ----------------
+
+		ZPointer<Chunk> m_chunk;
+
+		ZSize m_position;
+
+		ZSize m_next_chunk_size;
+
+	public:
+
+		#pragma region structor
+
+		~Arena (
+		) {
+			thiz.release();
+		}
+
+		// ----------------
+
+		Arena (
+		) :
+			Arena{k_default_chunk_size} {
+		}
+
+		Arena (
+			Arena const & that
+		) = delete;
+
+		Arena (
+			Arena && that
+		) = delete;
+
+		// ----------------
+
+		explicit Arena (
+			Size const & chunk_size
+		) :
+			m_chunk{nullptr},
+			m_position{0},
+			m_next_chunk_size{chunk_size.value} {
+		}
+
+		#pragma endregion
+
+		#pragma region operator
+
+		auto operator = (
+			Arena const & that
+		) -> Arena & = delete;
+
+		auto operator = (
+			Arena && that
+		) -> Arena & = delete;
+
+		#pragma endregion
+
+		#pragma region allocate
+
+		// NOTE : a block consume at least k_block_alignment byte, so even an empty block lie inside the chunk that own it
+		auto allocate (
+			Size const & size
+		) -> Pointer<Byte> {
+			auto aligned_size = maximum((size.value + k_block_alignment.value - 1) / k_block_alignment.value * k_block_alignment.value, k_block_alignment.value);
+			if (thiz.m_chunk == nullptr || thiz.m_position + aligned_size > thiz.m_chunk->capacity) {
+				thiz.append_chunk(aligned_size);
+			}
+			auto pointer = reinterpret_cast<ZPointer<ZByte>>(thiz.m_chunk + 1) + thiz.m_position;
+			thiz.m_position += aligned_size;
+			return make_pointer(reinterpret_cast<ZPointer<Byte>>(pointer));
+		}
+
+		// ----------------
+
+		// NOTE : keep the newest ( the largest ) chunk for reuse, release the others
+		auto reset (
+		) -> Void {
+			if (thiz.m_chunk != nullptr) {
+				auto next = thiz.m_chunk->next;
+				thiz.m_chunk->next = nullptr;
+				thiz.release_chunk(next);
+			}
+			thiz.m_position = 0;
+			return;
+		}
+
+		auto release (
+		) -> Void {
+			thiz.release_chunk(thiz.m_chunk);
+			thiz.m_chunk = nullptr;
+			thiz.m_position = 0;
+			return;
+		}
+
+		#pragma endregion
+
+		#pragma region query
+
+		inline static auto is_block (
+			ZPointer<void const> pointer
+		) -> Boolean {
+			return g_arena_chunk_registry.contains(pointer);
+		}
+
+		#pragma endregion
+
+	protected:
+
+		#pragma region implement
+
+		auto append_chunk (
+			ZSize const & size
+		) -> Void {
+			auto capacity = maximum(size, thiz.m_next_chunk_size);
+			auto chunk = static_cast<ZPointer<Chunk>>(::operator new(sizeof(Chunk) + capacity, std::align_val_t{alignof(Chunk)}));
+			chunk->next = thiz.m_chunk;
+			chunk->capacity = capacity;
+			g_arena_chunk_registry.insert(chunk + 1, capacity);
+			thiz.m_chunk = chunk;
+			thiz.m_position = 0;
+			thiz.m_next_chunk_size = minimum(thiz.m_next_chunk_size * 2, k_maximum_chunk_size.value);
+			return;
+		}
+
+		inline static auto release_chunk (
+			ZPointer<Chunk> chunk
+		) -> Void {
+			while (chunk != nullptr) {
+				auto next = chunk->next;
+				g_arena_chunk_registry.remove(chunk + 1);
+				::operator delete(chunk, std::align_val_t{alignof(Chunk)});
+				chunk = next;
+			}
+			return;
+		}
+
+		#pragma endregion
+
+	};
+
+	// ----------------
+
+	inline thread_local auto g_arena = Pointer<Arena>{k_null_pointer};
+
+	// ----------------
+
+	// NOTE
+	// bind an arena ( or none, to allocate from the heap ) to the current thread, the previous binding is restored on destruction
+	// the binding must be suspended by binding none where the data escape into something that outlive the arena, such as a global cache
+	class ArenaScope {
+
+	protected:
+
+		Pointer<Arena> m_previous;
+
+	public:
+
+		#pragma region structor
+
+		~ArenaScope (
+		) {
+			g_arena = thiz.m_previous;
+		}
+
+		// ----------------
+
+		ArenaScope (
+		) = delete;
+
+		ArenaScope (
+			ArenaScope const & that
+		) = delete;
+
+		ArenaScope (
+			ArenaScope && that
+		) = delete;
+
+		// ----------------
+
+		explicit ArenaScope (
+			Arena & arena
+		) :
+			m_previous{g_arena} {
+			g_arena = make_pointer(&arena);
+		}
+
+		explicit ArenaScope (
+			Null const & null
+		) :
+			m_previous{g_arena} {
+			g_arena = k_null_pointer;
+		}
+
+		#pragma endregion
+
+		#pragma region operator
+
+		auto operator = (
+			ArenaScope const & that
+		) -> ArenaScope & = delete;
+
+		auto operator = (
+			ArenaScope && that
+		) -> ArenaScope & = delete;
+
+		#pragma endregion
+
+	};
+
+	#pragma endregion
+
 	#pragma region single allocate
 
 	template <typename It, typename ... Argument> requires
@@ -31,27 +368,113 @@ namespace TwinStar::Kernel {
 
 	#pragma region array allocate
 
+	// NOTE
+	// the storage of an instance array come from the arena bound to the current thread if any, else from the heap, no extra byte is allocated for either
+	// the element of an over-aligned type is always allocated from the heap
+	// storage not come from allocate_instance_array must never be bound to a container
+	template <typename It> requires
+		CategoryConstraint<IsInstance<It>>
+	inline auto allocate_instance_array_storage (
+		Size const & size
+	) -> Pointer<It> {
+		auto storage_size = sizeof(It) * size.value;
+		if constexpr (alignof(It) <= Arena::k_block_alignment.value) {
+			if (g_arena != k_null_pointer) {
+				return make_pointer(reinterpret_cast<ZPointer<It>>(g_arena.value->allocate(mbw<Size>(storage_size)).value));
+			}
+		}
+		if constexpr (alignof(It) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+			return make_pointer(static_cast<ZPointer<It>>(::operator new(storage_size)));
+		}
+		else {
+			return make_pointer(static_cast<ZPointer<It>>(::operator new(storage_size, std::align_val_t{alignof(It)})));
+		}
+	}
+
+	// NOTE : element is not destructed, only for element that is trivially destructible or already destructed
+	template <typename It> requires
+		CategoryConstraint<IsInstance<It>>
+	inline auto free_instance_array_storage (
+		Pointer<It> const & pointer
+	) -> Void {
+		auto storage = static_cast<ZPointer<void>>(const_cast<ZPointer<AsPure<It>>>(pointer.value));
+		if (Arena::is_block(storage)) {
+			return;
+		}
+		if constexpr (alignof(It) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+			::operator delete(storage);
+		}
+		else {
+			::operator delete(storage, std::align_val_t{alignof(It)});
+		}
+		return;
+	}
+
+	template <typename It> requires
+		CategoryConstraint<IsInstance<It>>
+	inline auto is_arena_instance_array (
+		Pointer<It> const & pointer
+	) -> Boolean {
+		return Arena::is_block(static_cast<ZPointer<void const>>(pointer.value));
+	}
+
+	// ----------------
+
 	template <typename It, typename ... Argument> requires
 		CategoryConstraint<IsInstance<It> && IsPureInstance<Argument ...>>
 		&& (IsDefaultConstructible<AsPure<It>>)
 		&& (IsConstructible<AsPure<It>, Argument const & ...>)
-	inline constexpr auto allocate_instance_array (
+	inline auto allocate_instance_array (
 		Size const &         size,
 		Argument const & ... argument
 	) -> Pointer<It> {
-		auto pointer = make_pointer(new It[size.value]{});
+		auto pointer = allocate_instance_array_storage<It>(size);
+		std::uninitialized_value_construct_n(pointer.value, size.value);
 		if constexpr (sizeof...(Argument) != 0_szz) {
 			Range::restruct(make_range_n(pointer, size), argument ...);
 		}
 		return pointer;
 	}
 
+	// NOTE
+	// move the first retain_size element of the old array of old_size element into a new array of size element, then free the old array, pointer may be null
+	// element of trivially relocatable type is moved by copying its byte, the old one is never destructed
+	template <typename It> requires
+		CategoryConstraint<IsPureInstance<It>>
+		&& (IsDefaultConstructible<It>)
+		&& (IsMoveConstructible<It>)
+	inline auto reallocate_instance_array (
+		Pointer<It> &  pointer,
+		Size const &   old_size,
+		Size const &   retain_size,
+		Size const &   size
+	) -> Void {
+		auto old_pointer = pointer;
+		assert_test(retain_size <= old_size && retain_size <= size);
+		pointer = allocate_instance_array_storage<It>(size);
+		if constexpr (IsTriviallyRelocatable<It>) {
+			std::memcpy(static_cast<ZPointer<void>>(pointer.value), static_cast<ZPointer<void const>>(old_pointer.value), sizeof(It) * retain_size.value);
+		}
+		else {
+			std::uninitialized_move_n(old_pointer.value, retain_size.value, pointer.value);
+			std::destroy_n(old_pointer.value, retain_size.value);
+		}
+		std::uninitialized_value_construct_n(pointer.value + retain_size.value, (size - retain_size).value);
+		if (old_pointer != k_null_pointer) {
+			std::destroy_n(old_pointer.value + retain_size.value, (old_size - retain_size).value);
+			free_instance_array_storage(old_pointer);
+		}
+		return;
+	}
+
 	template <typename It> requires
 		CategoryConstraint<IsInstance<It>>
-	inline constexpr auto free_instance_array (
-		Pointer<It> & pointer
+	inline auto free_instance_array (
+		Pointer<It> & pointer,
+		Size const &  size
 	) -> Void {
-		delete[] pointer.value;
+		std::destroy_n(pointer.value, size.value);
+		free_instance_array_storage(pointer);
 		pointer = k_null_pointer;
 		return;
 	}
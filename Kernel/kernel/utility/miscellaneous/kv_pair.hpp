@@ -49,4 +49,11 @@ namespace TwinStar::Kernel {
 
 	#pragma endregion
 
+	#pragma region trait
+
+	template <typename Key, typename Value>
+	inline constexpr auto Trait::k_trivially_relocatable<KVPair<Key, Value>> = Trait::k_trivially_relocatable<Key> && Trait::k_trivially_relocatable<Value>;
+
+	#pragma endregion
+
 }
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "kernel/utility/miscellaneous/thread.hpp"
+#include "kernel/utility/support/byte_stream.hpp"
+#include <atomic>
+#include <mutex>
+#include <exception>
+
+namespace TwinStar::Kernel {
+
+	#pragma region utility
+
+	inline auto hardware_thread_count (
+	) -> Size {
+		return maximum(mbw<Size>(std::thread::hardware_concurrency()), 1_sz);
+	}
+
+	// ----------------
+
+	// NOTE
+	// call executor(index) for each index in [0, count), spread across worker threads
+	// the calling thread take part in the work, and the thread-local byte stream endian is inherited by workers
+	// the first exception thrown by executor is rethrown after every worker finished
+	template <typename Executor> requires
+		CategoryConstraint<IsPureInstance<Executor>>
+		&& (IsGenericCallable<Executor>)
+	inline auto parallel_each (
+		Size const &     count,
+		Executor const & executor,
+		Size const &     thread_limit = k_none_size
+	) -> Void {
+		auto thread_count = minimum(thread_limit == k_none_size ? (hardware_thread_count()) : (thread_limit), count);
+		if (thread_count <= 1_sz) {
+			for (auto & index : SizeRange{count}) {
+				executor(index);
+			}
+			return;
+		}
+		auto use_big_endian = g_byte_stream_use_big_endian;
+		auto next_index = std::atomic<ZSize>{k_begin_index.value};
+		auto failed = std::atomic<ZBoolean>{false};
+		auto exception = std::exception_ptr{};
+		auto exception_mutex = std::mutex{};
+		auto worker = [&] (
+		) -> Void {
+			g_byte_stream_use_big_endian = use_big_endian;
+			while (!failed.load()) {
+				auto index = next_index.fetch_add(1_szz);
+				if (index >= count.value) {
+					break;
+				}
+				try {
+					executor(mbw<Size>(index));
+				}
+				catch (...) {
+					auto lock = std::lock_guard<std::mutex>{exception_mutex};
+					if (!exception) {
+						exception = std::current_exception();
+					}
+					failed.store(true);
+				}
+			}
+			return;
+		};
+		auto thread_list = List<Thread>{};
+		thread_list.allocate_full(thread_count - 1_sz);
+		for (auto & thread : thread_list) {
+			thread.run(worker);
+		}
+		worker();
+		for (auto & thread : thread_list) {
+			thread.join();
+		}
+		if (exception) {
+			std::rethrow_exception(exception);
+		}
+		return;
+	}
+
+	#pragma endregion
+
+}
@@ -65,6 +65,20 @@ namespace TwinStar::Kernel {
 
 	#pragma endregion
 
+	#pragma region trait
+
+	// NOTE : a record is trivially relocatable if every member variable is
+	template <typename It> requires
+		CategoryConstraint<IsPureInstance<It>>
+		&& (IsDerivedFrom<It, Record>)
+	inline constexpr auto Trait::k_trivially_relocatable<It> = [] <typename ... Field> (
+		TypePackage<Field ...>
+	) -> bool {
+		return (Trait::k_trivially_relocatable<AsPure<decltype(declare<It &>().*Field::value)>> && ...);
+	}(typename It::Reflection::MemberVariable{});
+
+	#pragma endregion
+
 }
 
 #define M_record_field(_expression)\
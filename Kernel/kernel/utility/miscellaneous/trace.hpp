@@ -0,0 +1,329 @@
+#pragma once
+
+#include "kernel/utility/container/optional/optional.hpp"
+#include "kernel/utility/container/list/list.hpp"
+#include "kernel/utility/string/string.hpp"
+#include "kernel/utility/data/json/value.hpp"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+namespace TwinStar::Kernel {
+
+	#pragma region type
+
+	// NOTE
+	// process-wide collector of named span, disabled by default, a disabled span cost one relaxed atomic load
+	// span name must refer to static storage, e.g. a "..."_sv literal, it is kept by view
+	// timestamp and duration are in microsecond since the last clear
+	class Tracer {
+
+	public:
+
+		struct Event {
+			CStringView name;
+			ZIntegerU64 begin;
+			ZIntegerU64 duration;
+			ZIntegerU64 thread;
+			ZSize       byte_in;
+			ZSize       byte_out;
+		};
+
+		// ----------------
+
+		inline static constexpr auto k_event_limit = Size{1048576_sz};
+
+	protected:
+
+		std::atomic<ZBoolean> m_enabled;
+
+		// NOTE : tick count of the steady clock, atomic since a span may close on a worker thread during clear
+		std::atomic<std::chrono::steady_clock::rep> m_origin;
+
+		List<Event> m_event;
+
+		ZSize m_dropped_event_count;
+
+		std::mutex m_mutex;
+
+	public:
+
+		#pragma region structor
+
+		~Tracer (
+		) = default;
+
+		// ----------------
+
+		Tracer (
+		) :
+			m_enabled{false},
+			m_origin{std::chrono::steady_clock::now().time_since_epoch().count()},
+			m_event{},
+			m_dropped_event_count{0},
+			m_mutex{} {
+		}
+
+		Tracer (
+			Tracer const & that
+		) = delete;
+
+		Tracer (
+			Tracer && that
+		) = delete;
+
+		#pragma endregion
+
+		#pragma region operator
+
+		auto operator = (
+			Tracer const & that
+		) -> Tracer & = delete;
+
+		auto operator = (
+			Tracer && that
+		) -> Tracer & = delete;
+
+		#pragma endregion
+
+		#pragma region state
+
+		auto enabled (
+		) const -> Boolean {
+			return mbw<Boolean>(thiz.m_enabled.load(std::memory_order_relaxed));
+		}
+
+		auto set_enabled (
+			Boolean const & enabled
+		) -> Void {
+			thiz.m_enabled.store(enabled.value, std::memory_order_relaxed);
+			return;
+		}
+
+		auto clear (
+		) -> Void {
+			auto lock = std::lock_guard<std::mutex>{thiz.m_mutex};
+			thiz.m_origin.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+			thiz.m_event.reset();
+			thiz.m_dropped_event_count = 0;
+			return;
+		}
+
+		#pragma endregion
+
+		#pragma region record
+
+		auto now (
+		) const -> ZIntegerU64 {
+			auto origin = std::chrono::steady_clock::time_point{std::chrono::steady_clock::duration{thiz.m_origin.load(std::memory_order_relaxed)}};
+			return static_cast<ZIntegerU64>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - origin).count());
+		}
+
+		auto record (
+			Event const & event
+		) -> Void {
+			auto lock = std::lock_guard<std::mutex>{thiz.m_mutex};
+			auto arena_scope = ArenaScope{k_null};
+			if (thiz.m_event.size() >= k_event_limit) {
+				++thiz.m_dropped_event_count;
+				return;
+			}
+			thiz.m_event.append(event);
+			return;
+		}
+
+		// ----------------
+
+		// NOTE : small sequential id, stable for the lifetime of the thread
+		inline static auto current_thread (
+		) -> ZIntegerU64 {
+			static auto next_thread = std::atomic<ZIntegerU64>{1};
+			thread_local auto thread = next_thread.fetch_add(1);
+			return thread;
+		}
+
+		#pragma endregion
+
+		#pragma region export
+
+		// NOTE : { span : [ { name, count, duration, duration_maximum, byte_in, byte_out } ], thread_count, dropped_event_count }, span sorted by first occurrence
+		auto summary (
+		) -> JSON::Value {
+			auto lock = std::lock_guard<std::mutex>{thiz.m_mutex};
+			auto result = JSON::Value{};
+			auto & result_object = result.set_object();
+			auto & span_array = make_member(result_object, "span"_s).set_array();
+			auto span_name = List<CStringView>{};
+			auto thread = List<ZIntegerU64>{};
+			for (auto & event : thiz.m_event) {
+				auto span_index = Optional<Size>{};
+				for (auto & index : SizeRange{span_name.size()}) {
+					if (span_name[index] == event.name) {
+						span_index.set(index);
+						break;
+					}
+				}
+				if (!span_index.has()) {
+					span_index.set(span_name.size());
+					span_name.append(event.name);
+					auto & span_object = span_array.append().set_object();
+					make_member(span_object, "name"_s).set_string(event.name);
+					make_member(span_object, "count"_s).set_number().set_integer(0_i);
+					make_member(span_object, "duration"_s).set_number().set_integer(0_i);
+					make_member(span_object, "duration_maximum"_s).set_number().set_integer(0_i);
+					make_member(span_object, "byte_in"_s).set_number().set_integer(0_i);
+					make_member(span_object, "byte_out"_s).set_number().set_integer(0_i);
+				}
+				auto & span_object = span_array[span_index.get()].get_object();
+				span_object.at(1_ix).value.get_number().get_integer() += 1_i;
+				span_object.at(2_ix).value.get_number().get_integer() += mbw<Integer>(event.duration);
+				auto & duration_maximum = span_object.at(3_ix).value.get_number().get_integer();
+				duration_maximum = maximum(duration_maximum, mbw<Integer>(event.duration));
+				span_object.at(4_ix).value.get_number().get_integer() += mbw<Integer>(event.byte_in);
+				span_object.at(5_ix).value.get_number().get_integer() += mbw<Integer>(event.byte_out);
+				if (!Range::has(thread, event.thread)) {
+					thread.append(event.thread);
+				}
+			}
+			make_member(result_object, "thread_count"_s).set_number().set_integer(cbw<Integer>(thread.size()));
+			make_member(result_object, "dropped_event_count"_s).set_number().set_integer(mbw<Integer>(thiz.m_dropped_event_count));
+			return result;
+		}
+
+		// NOTE : Chrome trace-event format, every span is a complete event ( ph = X ), load by chrome://tracing or Perfetto
+		auto export_chrome_trace (
+		) -> JSON::Value {
+			auto lock = std::lock_guard<std::mutex>{thiz.m_mutex};
+			auto result = JSON::Value{};
+			auto & result_object = result.set_object();
+			auto & event_array = make_member(result_object, "traceEvents"_s).set_array();
+			event_array.allocate(thiz.m_event.size());
+			for (auto & event : thiz.m_event) {
+				auto & event_object = event_array.append().set_object();
+				make_member(event_object, "name"_s).set_string(event.name);
+				make_member(event_object, "cat"_s).set_string("kernel"_s);
+				make_member(event_object, "ph"_s).set_string("X"_s);
+				make_member(event_object, "ts"_s).set_number().set_integer(mbw<Integer>(event.begin));
+				make_member(event_object, "dur"_s).set_number().set_integer(mbw<Integer>(event.duration));
+				make_member(event_object, "pid"_s).set_number().set_integer(1_i);
+				make_member(event_object, "tid"_s).set_number().set_integer(mbw<Integer>(event.thread));
+				auto & argument_object = make_member(event_object, "args"_s).set_object();
+				make_member(argument_object, "byte_in"_s).set_number().set_integer(mbw<Integer>(event.byte_in));
+				make_member(argument_object, "byte_out"_s).set_number().set_integer(mbw<Integer>(event.byte_out));
+			}
+			make_member(result_object, "displayTimeUnit"_s).set_string("ms"_s);
+			return result;
+		}
+
+		#pragma endregion
+
+	protected:
+
+		#pragma region implement
+
+		inline static auto make_member (
+			JSON::Object & object,
+			String const & key
+		) -> JSON::Value & {
+			auto & member = object.append();
+			member.key = key;
+			return member.value;
+		}
+
+		#pragma endregion
+
+	};
+
+	// ----------------
+
+	inline auto g_tracer = Tracer{};
+
+	// ----------------
+
+	// NOTE : record a span from construction to destruction, byte counter may be set at any time before destruction
+	class TraceSpan {
+
+	protected:
+
+		Optional<Tracer::Event> m_event;
+
+	public:
+
+		#pragma region structor
+
+		~TraceSpan (
+		) {
+			if (thiz.m_event.has()) {
+				auto & event = thiz.m_event.get();
+				event.duration = g_tracer.now() - event.begin;
+				g_tracer.record(event);
+			}
+		}
+
+		// ----------------
+
+		TraceSpan (
+		) = delete;
+
+		TraceSpan (
+			TraceSpan const & that
+		) = delete;
+
+		TraceSpan (
+			TraceSpan && that
+		) = delete;
+
+		// ----------------
+
+		explicit TraceSpan (
+			CStringView const & name
+		) :
+			m_event{} {
+			if (g_tracer.enabled()) {
+				thiz.m_event.set(
+					Tracer::Event{
+						.name = name,
+						.begin = g_tracer.now(),
+						.duration = 0,
+						.thread = Tracer::current_thread(),
+						.byte_in = 0,
+						.byte_out = 0,
+					}
+				);
+			}
+		}
+
+		#pragma endregion
+
+		#pragma region operator
+
+		auto operator = (
+			TraceSpan const & that
+		) -> TraceSpan & = delete;
+
+		auto operator = (
+			TraceSpan && that
+		) -> TraceSpan & = delete;
+
+		#pragma endregion
+
+		#pragma region counter
+
+		auto set_byte (
+			Size const & byte_in,
+			Size const & byte_out
+		) -> Void {
+			if (thiz.m_event.has()) {
+				thiz.m_event.get().byte_in = byte_in.value;
+				thiz.m_event.get().byte_out = byte_out.value;
+			}
+			return;
+		}
+
+		#pragma endregion
+
+	};
+
+	#pragma endregion
+
+}
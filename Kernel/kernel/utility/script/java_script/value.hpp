@@ -783,7 +783,7 @@ namespace TwinStar::Kernel::JavaScript {
 					!is_holder
 					? nullptr
 					: [] (quickjs::JSRuntime * rt, void * opaque, void * ptr) -> void {
-						delete[] static_cast<uint8_t *>(ptr);
+						free_instance_array_storage(make_pointer(static_cast<ZPointer<Byte>>(ptr)));
 						return;
 					},
 					nullptr,
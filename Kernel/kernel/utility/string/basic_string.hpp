@@ -371,4 +371,11 @@ namespace TwinStar::Kernel {
 
 	#pragma endregion
 
+	#pragma region trait
+
+	template <typename Element>
+	inline constexpr auto Trait::k_trivially_relocatable<BasicString<Element>> = bool{true};
+
+	#pragma endregion
+
 }
@@ -1,35 +1,294 @@
 #pragma once
 
 #include "kernel/utility/string/string.hpp"
-#include <locale>
-#include <codecvt>
 
 namespace TwinStar::Kernel::StringEncoding {
 
+	#pragma region detail
+
+	namespace Detail {
+
+		// NOTE
+		// ascii run is tested one 64-bit word at a time ( 8 utf-8 unit or 4 utf-16 unit ), without target-specific intrinsic, so the same code run on every supported architecture
+		// the compiler is free to widen the word loop further
+
+		inline constexpr auto k_utf8_ascii_mask = ZIntegerU64{0x8080808080808080ull};
+
+		inline constexpr auto k_utf16_ascii_mask = ZIntegerU64{0xFF80FF80FF80FF80ull};
+
+		// ----------------
+
+		inline auto compute_utf8_ascii_size (
+			ZPointer<ZCharacter8 const> const & data,
+			ZSize const &                       size
+		) -> ZSize {
+			auto index = ZSize{0};
+			while (index + 8 <= size) {
+				auto word = ZIntegerU64{};
+				std::memcpy(&word, data + index, 8);
+				if ((word & k_utf8_ascii_mask) != 0) {
+					break;
+				}
+				index += 8;
+			}
+			while (index < size && data[index] < 0x80) {
+				++index;
+			}
+			return index;
+		}
+
+		inline auto compute_utf16_ascii_size (
+			ZPointer<ZCharacter16 const> const & data,
+			ZSize const &                        size
+		) -> ZSize {
+			auto index = ZSize{0};
+			while (index + 4 <= size) {
+				auto word = ZIntegerU64{};
+				std::memcpy(&word, data + index, 8);
+				if ((word & k_utf16_ascii_mask) != 0) {
+					break;
+				}
+				index += 4;
+			}
+			while (index < size && data[index] < 0x80) {
+				++index;
+			}
+			return index;
+		}
+
+		// ----------------
+
+		// NOTE : loose form, only check the lead unit and the continuation unit, the same rule as StringParser use
+		inline auto skip_utf8_character (
+			ZPointer<ZCharacter8 const> const & data,
+			ZSize const &                       size,
+			ZSize &                             index
+		) -> Void {
+			auto lead = static_cast<ZIntegerU8>(data[index]);
+			auto extra_size = ZSize{};
+			if (lead < 0b1'0000000) {
+				extra_size = 0;
+			}
+			else if (lead < 0b11'000000) {
+				assert_fail(R"(/* first utf-8 character is valid */)");
+			}
+			else if (lead < 0b111'00000) {
+				extra_size = 1;
+			}
+			else if (lead < 0b1111'0000) {
+				extra_size = 2;
+			}
+			else if (lead < 0b11111'000) {
+				extra_size = 3;
+			}
+			else {
+				assert_fail(R"(/* first utf-8 character is valid */)");
+			}
+			++index;
+			if (index + extra_size > size) {
+				assert_fail(R"(/* extra utf-8 character is valid */)");
+			}
+			while (extra_size > 0) {
+				--extra_size;
+				if ((static_cast<ZIntegerU8>(data[index]) & 0b11'000000) != 0b10'000000) {
+					assert_fail(R"(/* extra utf-8 character is valid */)");
+				}
+				++index;
+			}
+			return;
+		}
+
+		// NOTE : strict form, reject overlong form, surrogate and code point above U+10FFFF
+		inline auto decode_utf8_character (
+			ZPointer<ZCharacter8 const> const & data,
+			ZSize const &                       size,
+			ZSize &                             index
+		) -> ZIntegerU32 {
+			auto lead = static_cast<ZIntegerU32>(data[index]);
+			auto extra_size = ZSize{};
+			auto minimum_character = ZIntegerU32{};
+			auto character = ZIntegerU32{};
+			if (lead < 0x80) {
+				++index;
+				return lead;
+			}
+			else if (lead < 0xC2) {
+				assert_fail(R"(/* first utf-8 character is valid */)");
+			}
+			else if (lead < 0xE0) {
+				extra_size = 1;
+				minimum_character = 0x80;
+				character = lead & 0b000'11111;
+			}
+			else if (lead < 0xF0) {
+				extra_size = 2;
+				minimum_character = 0x800;
+				character = lead & 0b0000'1111;
+			}
+			else if (lead < 0xF5) {
+				extra_size = 3;
+				minimum_character = 0x10000;
+				character = lead & 0b00000'111;
+			}
+			else {
+				assert_fail(R"(/* first utf-8 character is valid */)");
+			}
+			++index;
+			if (index + extra_size > size) {
+				assert_fail(R"(/* extra utf-8 character is valid */)");
+			}
+			while (extra_size > 0) {
+				--extra_size;
+				auto current = static_cast<ZIntegerU32>(data[index]);
+				if ((current & 0b11'000000) != 0b10'000000) {
+					assert_fail(R"(/* extra utf-8 character is valid */)");
+				}
+				character = character << 6 | (current & 0b00'111111);
+				++index;
+			}
+			if (character < minimum_character || character > 0x10FFFF || (character >= 0xD800 && character <= 0xDFFF)) {
+				assert_fail(R"(/* utf-8 character is valid */)");
+			}
+			return character;
+		}
+
+	}
+
+	#pragma endregion
+
+	#pragma region utf-8 measure
+
+	inline auto compute_utf8_ascii_size (
+		CBasicStringView<Character8> const & source
+	) -> Size {
+		return mbw<Size>(Detail::compute_utf8_ascii_size(cast_pointer<ZCharacter8>(source.begin()).value, source.size().value));
+	}
+
+	// NOTE : count character and check every character in loose form
+	inline auto compute_utf8_length (
+		CBasicStringView<Character8> const & source
+	) -> Size {
+		auto data = cast_pointer<ZCharacter8>(source.begin()).value;
+		auto size = source.size().value;
+		auto index = ZSize{0};
+		auto length = ZSize{0};
+		while (index < size) {
+			auto ascii_size = Detail::compute_utf8_ascii_size(data + index, size - index);
+			index += ascii_size;
+			length += ascii_size;
+			if (index < size) {
+				Detail::skip_utf8_character(data, size, index);
+				++length;
+			}
+		}
+		return mbw<Size>(length);
+	}
+
+	// NOTE : byte size of the first length character, check every character in loose form
+	inline auto compute_utf8_size_of_length (
+		CBasicStringView<Character8> const & source,
+		Size const &                         length
+	) -> Size {
+		auto data = cast_pointer<ZCharacter8>(source.begin()).value;
+		auto size = source.size().value;
+		auto index = ZSize{0};
+		auto reserve_length = length.value;
+		while (reserve_length > 0) {
+			auto ascii_size = Detail::compute_utf8_ascii_size(data + index, minimum(size - index, reserve_length));
+			index += ascii_size;
+			reserve_length -= ascii_size;
+			if (reserve_length > 0) {
+				if (index >= size) {
+					assert_fail(R"(/* first utf-8 character is valid */)");
+				}
+				Detail::skip_utf8_character(data, size, index);
+				--reserve_length;
+			}
+		}
+		return mbw<Size>(index);
+	}
+
+	#pragma endregion
+
 	#pragma region utf-8 & utf-16
 
 	inline auto utf8_to_utf16 (
 		CBasicStringView<Character8> const & source
 	) -> BasicString<Character16> {
-		auto converter = std::wstring_convert<std::codecvt_utf8_utf16<ZCharacter16>, ZCharacter16>{};
-		auto result = converter.from_bytes(
-			cast_pointer<ZCharacterN>(source.begin()).value,
-			cast_pointer<ZCharacterN>(source.end()).value
-		);
-		assert_test(converter.converted() == source.size().value);
-		return BasicString<Character16>{cast_pointer<Character16>(make_pointer(result.data())), mbw<Size>(result.size())};
+		auto source_data = cast_pointer<ZCharacter8>(source.begin()).value;
+		auto source_size = source.size().value;
+		auto result = BasicString<Character16>{};
+		result.allocate_full(source.size());
+		auto result_data = cast_pointer<ZCharacter16>(result.begin()).value;
+		auto result_size = ZSize{0};
+		auto index = ZSize{0};
+		while (index < source_size) {
+			auto ascii_size = Detail::compute_utf8_ascii_size(source_data + index, source_size - index);
+			for (auto ascii_index = ZSize{0}; ascii_index < ascii_size; ++ascii_index) {
+				result_data[result_size + ascii_index] = static_cast<ZCharacter16>(source_data[index + ascii_index]);
+			}
+			index += ascii_size;
+			result_size += ascii_size;
+			if (index < source_size) {
+				auto character = Detail::decode_utf8_character(source_data, source_size, index);
+				if (character < 0x10000) {
+					result_data[result_size++] = static_cast<ZCharacter16>(character);
+				}
+				else {
+					character -= 0x10000;
+					result_data[result_size++] = static_cast<ZCharacter16>(0xD800 | (character >> 10));
+					result_data[result_size++] = static_cast<ZCharacter16>(0xDC00 | (character & 0x3FF));
+				}
+			}
+		}
+		result.set_size(mbw<Size>(result_size));
+		return result;
 	}
 
 	inline auto utf16_to_utf8 (
 		CBasicStringView<Character16> const & source
 	) -> BasicString<Character8> {
-		auto converter = std::wstring_convert<std::codecvt_utf8_utf16<ZCharacter16>, ZCharacter16>{};
-		auto result = converter.to_bytes(
-			cast_pointer<ZCharacter16>(source.begin()).value,
-			cast_pointer<ZCharacter16>(source.end()).value
-		);
-		assert_test(converter.converted() == source.size().value);
-		return BasicString<Character8>{cast_pointer<Character8>(make_pointer(result.data())), mbw<Size>(result.size())};
+		auto source_data = cast_pointer<ZCharacter16>(source.begin()).value;
+		auto source_size = source.size().value;
+		auto result = BasicString<Character8>{};
+		result.allocate_full(source.size() * 3_sz);
+		auto result_data = cast_pointer<ZCharacter8>(result.begin()).value;
+		auto result_size = ZSize{0};
+		auto index = ZSize{0};
+		while (index < source_size) {
+			auto ascii_size = Detail::compute_utf16_ascii_size(source_data + index, source_size - index);
+			for (auto ascii_index = ZSize{0}; ascii_index < ascii_size; ++ascii_index) {
+				result_data[result_size + ascii_index] = static_cast<ZCharacter8>(source_data[index + ascii_index]);
+			}
+			index += ascii_size;
+			result_size += ascii_size;
+			if (index < source_size) {
+				auto character = static_cast<ZIntegerU32>(source_data[index++]);
+				if (character >= 0xD800 && character <= 0xDFFF) {
+					if (character >= 0xDC00 || index >= source_size || source_data[index] < 0xDC00 || source_data[index] > 0xDFFF) {
+						assert_fail(R"(/* utf-16 surrogate pair is valid */)");
+					}
+					character = 0x10000 + ((character - 0xD800) << 10 | (static_cast<ZIntegerU32>(source_data[index++]) - 0xDC00));
+				}
+				if (character < 0x800) {
+					result_data[result_size++] = static_cast<ZCharacter8>(0b110'00000 | (character >> 6));
+					result_data[result_size++] = static_cast<ZCharacter8>(0b10'000000 | (character & 0b00'111111));
+				}
+				else if (character < 0x10000) {
+					result_data[result_size++] = static_cast<ZCharacter8>(0b1110'0000 | (character >> 12));
+					result_data[result_size++] = static_cast<ZCharacter8>(0b10'000000 | (character >> 6 & 0b00'111111));
+					result_data[result_size++] = static_cast<ZCharacter8>(0b10'000000 | (character & 0b00'111111));
+				}
+				else {
+					result_data[result_size++] = static_cast<ZCharacter8>(0b11110'000 | (character >> 18));
+					result_data[result_size++] = static_cast<ZCharacter8>(0b10'000000 | (character >> 12 & 0b00'111111));
+					result_data[result_size++] = static_cast<ZCharacter8>(0b10'000000 | (character >> 6 & 0b00'111111));
+					result_data[result_size++] = static_cast<ZCharacter8>(0b10'000000 | (character & 0b00'111111));
+				}
+			}
+		}
+		result.set_size(mbw<Size>(result_size));
+		return result;
 	}
 
 	#pragma endregion
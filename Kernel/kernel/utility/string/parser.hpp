@@ -3,6 +3,7 @@
 #include "kernel/utility/miscellaneous/character_series/stream.hpp"
 #include "kernel/utility/miscellaneous/character_series/type.hpp"
 #include "kernel/utility/string/string.hpp"
+#include "kernel/utility/string/encoding.hpp"
 #include "kernel/utility/base_wrapper/wrapper.hpp"
 #include "kernel/utility/null.hpp"
 #include "kernel/utility/miscellaneous/number_variant.hpp"
@@ -386,21 +387,8 @@ namespace TwinStar::Kernel::StringParser {
 		CStringView const &    string,
 		Size &                 length
 	) -> Void {
-		auto string_stream = ICharacterStreamView{string};
-		while (!string_stream.full()) {
-			auto current = self_cast<Character8>(string_stream.read_of());
-			auto extra_size = compute_utf8_character_extra_size(current);
-			stream.write(self_cast<Character>(current));
-			while (extra_size > 0_sz) {
-				--extra_size;
-				current = self_cast<Character8>(string_stream.read_of());
-				if ((current & 0b11'000000_c8) != 0b10'000000_c8) {
-					assert_fail(R"(/* extra utf-8 character is valid */)");
-				}
-				stream.write(self_cast<Character>(current));
-			}
-			++length;
-		}
+		length += StringEncoding::compute_utf8_length(self_cast<CBasicStringView<Character8>>(string));
+		std::memcpy(stream.forward_view(string.size()).begin().value, string.begin().value, string.size().value);
 		return;
 	}
 
@@ -409,20 +397,8 @@ namespace TwinStar::Kernel::StringParser {
 		CStringView &          string,
 		Size const &           length
 	) -> Void {
-		auto string_stream = ICharacterStreamView{stream.reserve_view()};
-		for (auto & index : SizeRange{length}) {
-			auto current = self_cast<Character8>(string_stream.read_of());
-			auto extra_size = compute_utf8_character_extra_size(current);
-			while (extra_size > 0_sz) {
-				--extra_size;
-				current = self_cast<Character8>(string_stream.read_of());
-				if ((current & 0b11'000000_c8) != 0b10'000000_c8) {
-					assert_fail(R"(/* extra utf-8 character is valid */)");
-				}
-			}
-		}
-		string = down_cast<CStringView>(string_stream.stream_view());
-		stream.forward(string_stream.position());
+		auto size = StringEncoding::compute_utf8_size_of_length(self_cast<CBasicStringView<Character8>>(down_cast<CStringView>(stream.reserve_view())), length);
+		string = down_cast<CStringView>(stream.forward_view(size));
 		return;
 	}
 
@@ -432,32 +408,16 @@ namespace TwinStar::Kernel::StringParser {
 		Size &                 length,
 		Size const &           size
 	) -> Void {
-		auto string_stream = ICharacterStreamView{stream.next_view(size)};
-		length = k_none_size;
-		while (!string_stream.full()) {
-			auto current = self_cast<Character8>(string_stream.read_of());
-			auto extra_size = compute_utf8_character_extra_size(current);
-			while (extra_size > 0_sz) {
-				--extra_size;
-				current = self_cast<Character8>(string_stream.read_of());
-				if ((current & 0b11'000000_c8) != 0b10'000000_c8) {
-					assert_fail(R"(/* extra utf-8 character is valid */)");
-				}
-			}
-			++length;
-		}
-		string = down_cast<CStringView>(string_stream.stream_view());
-		stream.forward(string_stream.position());
+		string = down_cast<CStringView>(stream.next_view(size));
+		length = StringEncoding::compute_utf8_length(self_cast<CBasicStringView<Character8>>(string));
+		stream.forward(size);
 		return;
 	}
 
 	inline auto compute_utf8_string_length (
 		CStringView const & string
 	) -> Size {
-		auto string_stream = ICharacterStreamView{string};
-		auto length = Size{};
-		read_utf8_string_by_size(string_stream, as_lvalue(CStringView{}), length, string.size());
-		return length;
+		return StringEncoding::compute_utf8_length(self_cast<CBasicStringView<Character8>>(string));
 	}
 
 	#pragma endregion
@@ -497,12 +457,34 @@ namespace TwinStar::Kernel::StringParser {
 
 	#pragma region escape utf-8 string until
 
+	// NOTE : size of the leading ascii run which contain neither control character, escape slash nor end identifier, such run is copied at once
+	inline auto compute_escape_plain_size (
+		CStringView const & string,
+		Character const &   end_identifier
+	) -> Size {
+		auto data = cast_pointer<ZCharacter8>(string.begin()).value;
+		auto size = string.size().value;
+		auto end = static_cast<ZCharacter8>(end_identifier.value);
+		auto index = ZSize{0};
+		while (index < size && data[index] < 0x80 && data[index] >= 0x20 && data[index] != 0x7F && data[index] != u8'\\' && data[index] != end) {
+			++index;
+		}
+		return mbw<Size>(index);
+	}
+
+	// ----------------
+
 	inline auto write_escape_utf8_string_until (
 		OCharacterStreamView & stream,
 		ICharacterStreamView & string,
 		Character const &      end_identifier
 	) -> Void {
 		while (!string.full()) {
+			auto plain_size = compute_escape_plain_size(down_cast<CStringView>(string.reserve_view()), end_identifier);
+			if (plain_size > 0_sz) {
+				std::memcpy(stream.forward_view(plain_size).begin().value, string.forward_view(plain_size).begin().value, plain_size.value);
+				continue;
+			}
 			auto current = string.read_of();
 			if (CharacterType::is_control(current) || current == CharacterType::k_escape_slash || current == end_identifier) {
 				stream.write(CharacterType::k_escape_slash);
@@ -530,6 +512,11 @@ namespace TwinStar::Kernel::StringParser {
 		Character const &      end_identifier
 	) -> Void {
 		while (k_true) {
+			auto plain_size = compute_escape_plain_size(down_cast<CStringView>(stream.reserve_view()), end_identifier);
+			if (plain_size > 0_sz) {
+				std::memcpy(string.forward_view(plain_size).begin().value, stream.forward_view(plain_size).begin().value, plain_size.value);
+				continue;
+			}
 			auto current = stream.read_of();
 			if (current == end_identifier) {
 				stream.backward();
@@ -213,6 +213,183 @@ namespace TwinStar::Kernel {
 
 	#pragma endregion
 
+	#pragma region endian
+
+	template <typename It>
+	concept IsByteStreamTrivial =
+		CategoryConstraint<IsPureInstance<It>>
+		&& (IsNumberWrapper<It> || IsCharacterWrapper<It> || IsByteWrapper<It> || IsEnumeratedWrapper<It>)
+		&& (!IsSizeWrapper<It>)
+		&& (sizeof(It) == sizeof(typename It::Value))
+		;
+
+	// NOTE
+	// byte order is fixed at compile time, the thread-local flag is never consulted
+	// only accept trivial value and list of trivial value, a list is transferred by one memcpy, or by one swap loop that the compiler is free to vectorize
+	template <auto t_mode, auto t_endian> requires
+		CategoryConstraint<>
+		&& (IsSameV<t_mode, StreamMode>)
+		&& (IsSameV<t_endian, std::endian>)
+	class EndianByteStreamView :
+		public ByteStreamView<t_mode> {
+
+	private:
+
+		using ByteStreamView = ByteStreamView<t_mode>;
+
+	public:
+
+		using ByteStreamView::mode;
+
+		inline static constexpr auto endian = std::endian{t_endian};
+
+	public:
+
+		#pragma region structor
+
+		~EndianByteStreamView (
+		) = default;
+
+		// ----------------
+
+		EndianByteStreamView (
+		) = default;
+
+		EndianByteStreamView (
+			EndianByteStreamView const & that
+		) = default;
+
+		EndianByteStreamView (
+			EndianByteStreamView && that
+		) = default;
+
+		// ----------------
+
+		using ByteStreamView::ByteStreamView;
+
+		#pragma endregion
+
+		#pragma region operator
+
+		auto operator = (
+			EndianByteStreamView const & that
+		) -> EndianByteStreamView & = default;
+
+		auto operator = (
+			EndianByteStreamView && that
+		) -> EndianByteStreamView & = default;
+
+		#pragma endregion
+
+		#pragma region write & read value
+
+		template <typename That> requires
+			CategoryConstraint<IsPureInstance<That>>
+			&& (IsByteStreamTrivial<That>)
+		auto write (
+			That const & that
+		) -> Void requires
+			(mode == StreamMode::Constant::o() || mode == StreamMode::Constant::io()) {
+			if constexpr (endian == std::endian::native) {
+				std::memcpy(thiz.current_pointer().value, &that, k_type_size<That>.value);
+			}
+			else {
+				auto that_reversed = reverse_endian(that);
+				std::memcpy(thiz.current_pointer().value, &that_reversed, k_type_size<That>.value);
+			}
+			thiz.forward(k_type_size<That>);
+			return;
+		}
+
+		template <typename That> requires
+			CategoryConstraint<IsPureInstance<That>>
+			&& (IsByteStreamTrivial<That>)
+		auto read (
+			That & that
+		) -> Void requires
+			(mode == StreamMode::Constant::i() || mode == StreamMode::Constant::io()) {
+			std::memcpy(&that, thiz.current_pointer().value, k_type_size<That>.value);
+			if constexpr (endian != std::endian::native) {
+				that = reverse_endian(that);
+			}
+			thiz.forward(k_type_size<That>);
+			return;
+		}
+
+		// ----------------
+
+		template <typename That> requires
+			CategoryConstraint<IsPureInstance<That>>
+			&& (IsByteStreamTrivial<That>)
+		auto read_of (
+		) -> That requires
+			(mode == StreamMode::Constant::i() || mode == StreamMode::Constant::io()) {
+			auto that = That{};
+			thiz.read(that);
+			return that;
+		}
+
+		#pragma endregion
+
+		#pragma region write & read list
+
+		template <typename Element, auto constant> requires
+			CategoryConstraint<IsPureInstance<Element>>
+			&& (IsByteStreamTrivial<Element>)
+		auto write (
+			ListView<Element, constant> const & that
+		) -> Void requires
+			(mode == StreamMode::Constant::o() || mode == StreamMode::Constant::io()) {
+			auto data = thiz.forward_view(k_type_size<Element> * that.size());
+			if constexpr (endian == std::endian::native) {
+				std::memcpy(data.begin().value, that.begin().value, data.size().value);
+			}
+			else {
+				auto data_pointer = data.begin().value;
+				for (auto & element : that) {
+					auto element_reversed = reverse_endian(element);
+					std::memcpy(data_pointer, &element_reversed, k_type_size<Element>.value);
+					data_pointer += k_type_size<Element>.value;
+				}
+			}
+			return;
+		}
+
+		template <typename Element> requires
+			CategoryConstraint<IsPureInstance<Element>>
+			&& (IsByteStreamTrivial<Element>)
+		auto read (
+			ListView<Element, false> const & that
+		) -> Void requires
+			(mode == StreamMode::Constant::i() || mode == StreamMode::Constant::io()) {
+			auto data = thiz.forward_view(k_type_size<Element> * that.size());
+			std::memcpy(that.begin().value, data.begin().value, data.size().value);
+			if constexpr (endian != std::endian::native) {
+				for (auto & element : that) {
+					element = reverse_endian(element);
+				}
+			}
+			return;
+		}
+
+		#pragma endregion
+
+	};
+
+	// ----------------
+
+	template <auto endian, auto mode> requires
+		CategoryConstraint<>
+		&& (IsSameV<endian, std::endian>)
+		&& (IsSameV<mode, StreamMode>)
+	inline auto as_endian_byte_stream (
+		ByteStreamView<mode> & it
+	) -> EndianByteStreamView<mode, endian> & {
+		return self_cast<EndianByteStreamView<mode, endian>>(it);
+	}
+
+	#pragma endregion
+
 	#pragma region container
 
 	template <typename TElement, auto t_constant> requires
@@ -236,19 +413,35 @@ namespace TwinStar::Kernel {
 		static auto size (
 			That const & that
 		) -> Size {
-			auto result = k_none_size;
-			for (auto & element : that) {
-				result += bs_size(element);
+			if constexpr (IsByteStreamTrivial<TElement>) {
+				return k_type_size<TElement> * that.size();
+			}
+			else {
+				auto result = k_none_size;
+				for (auto & element : that) {
+					result += bs_size(element);
+				}
+				return result;
 			}
-			return result;
 		}
 
+		// NOTE : a list of trivial value check the thread-local flag once, then move in bulk
 		static auto write (
 			ThisO &      thix,
 			That const & that
 		) -> Void {
-			for (auto & element : that) {
-				thix.write(element);
+			if constexpr (IsByteStreamTrivial<TElement>) {
+				if (g_byte_stream_use_big_endian) {
+					as_endian_byte_stream<std::endian::big>(thix).write(that);
+				}
+				else {
+					as_endian_byte_stream<std::endian::little>(thix).write(that);
+				}
+			}
+			else {
+				for (auto & element : that) {
+					thix.write(element);
+				}
 			}
 			return;
 		}
@@ -258,8 +451,18 @@ namespace TwinStar::Kernel {
 			That const & that
 		) -> Void requires
 			(!t_constant) {
-			for (auto & element : that) {
-				thix.read(element);
+			if constexpr (IsByteStreamTrivial<TElement>) {
+				if (g_byte_stream_use_big_endian) {
+					as_endian_byte_stream<std::endian::big>(thix).read(that);
+				}
+				else {
+					as_endian_byte_stream<std::endian::little>(thix).read(that);
+				}
+			}
+			else {
+				for (auto & element : that) {
+					thix.read(element);
+				}
 			}
 			return;
 		}
@@ -9,6 +9,8 @@
 #include "kernel/utility/data/xml/node.hpp"
 #include "kernel/utility/image/pixel.hpp"
 #include "kernel/utility/file_system/path.hpp"
+#include "kernel/utility/support/std.hpp"
+#include <unordered_map>
 
 namespace TwinStar::Kernel::JavaScript {
 
@@ -950,10 +952,15 @@ namespace TwinStar::Kernel::JavaScript {
 			return;
 		}
 
+		// NOTE : the storage from an arena die with the arena, so it is copied instead of hold
 		static auto from (
 			This &  thix,
 			That && that
 		) -> Void {
+			if (is_arena_instance_array(that.begin())) {
+				thix.set_object_of_array_buffer(that.view());
+				return;
+			}
 			thix.set_object_of_array_buffer(that.view(), k_true);
 			that.unbind();
 			return;
@@ -1205,62 +1212,129 @@ namespace TwinStar::Kernel::JavaScript {
 
 		// ----------------
 
-		static auto from (
-			This &       thix,
-			That const & that
-		) -> Void {
+		// NOTE
+		// the tree is converted by raw quickjs call, no intermediate Value is created for each node
+		// every distinct object key is converted to atom once per conversion, then reused by every object that has the same key
+		using AtomCache = std::unordered_map<CStringView, quickjs::JSAtom>;
+
+		// ----------------
+
+		static auto make_value (
+			ZPointer<quickjs::JSContext> const & context,
+			AtomCache &                          atom_cache,
+			That const &                         that
+		) -> quickjs::JSValue {
 			using namespace JSON;
+			auto result = quickjs::JS_UNINITIALIZED_;
 			switch (that.type().value) {
 				case ValueType::Constant::null().value : {
-					thix.from(that.get_null());
+					result = quickjs::JS_NULL_;
 					break;
 				}
 				case ValueType::Constant::boolean().value : {
-					thix.from(that.get_boolean());
+					result = quickjs::JS_NewBool(context, that.get_boolean().value);
 					break;
 				}
 				case ValueType::Constant::number().value : {
-					thix.from(that.get_number());
+					auto & number = that.get_number();
+					if (number.is_integer()) {
+						result = quickjs::JS_NewBigInt64(context, number.get_integer().value);
+					}
+					else {
+						result = quickjs::JS_NewFloat64(context, number.get_floater().value);
+					}
 					break;
 				}
 				case ValueType::Constant::string().value : {
-					thix.from(that.get_string());
+					auto & string = that.get_string();
+					result = quickjs::JS_NewStringLen(context, cast_pointer<char>(string.begin()).value, string.size().value);
 					break;
 				}
 				case ValueType::Constant::array().value : {
-					thix.from(that.get_array());
+					auto & array = that.get_array();
+					result = quickjs::JS_NewArray(context);
+					for (auto & index : SizeRange{array.size()}) {
+						auto state = quickjs::JS_DefinePropertyValueUint32(context, result, static_cast<uint32_t>(index.value), make_value(context, atom_cache, array[index]), quickjs::JS_PROP_C_W_E_);
+						assert_test(state != -1);
+					}
 					break;
 				}
 				case ValueType::Constant::object().value : {
-					thix.from(that.get_object());
+					auto & object = that.get_object();
+					result = quickjs::JS_NewObject(context);
+					for (auto & member : object) {
+						auto key = member.key.as_view();
+						auto atom = atom_cache.find(key);
+						if (atom == atom_cache.end()) {
+							atom = atom_cache.emplace(key, quickjs::JS_NewAtomLen(context, cast_pointer<char>(key.begin()).value, key.size().value)).first;
+						}
+						auto state = quickjs::JS_DefinePropertyValue(context, result, (*atom).second, make_value(context, atom_cache, member.value), quickjs::JS_PROP_C_W_E_);
+						assert_test(state != -1);
+					}
 					break;
 				}
 			}
-			return;
+			return result;
 		}
 
-		static auto to (
-			This & thix,
-			That & that
+		// NOTE : only array and object whose prototype is Object.prototype are accepted as container
+		static auto take_value (
+			ZPointer<quickjs::JSContext> const & context,
+			quickjs::JSValue const &             object_prototype,
+			quickjs::JSValue const &             thix,
+			That &                               that
 		) -> Void {
-			using namespace JSON;
-			if (thix.is_null()) {
-				thix.to(that.set_null());
+			if (quickjs::JS_IsNull(thix)) {
+				that.set_null();
 			}
-			else if (thix.is_boolean()) {
-				thix.to(that.set_boolean());
+			else if (quickjs::JS_IsBool(thix)) {
+				that.set_boolean(mbw<Boolean>(quickjs::JS_ToBool(context, thix)));
 			}
-			else if (thix.is_number() || thix.is_bigint()) {
-				thix.to(that.set_number());
+			else if (quickjs::JS_IsBigInt(context, thix)) {
+				auto value = int64_t{};
+				quickjs::JS_ToBigInt64(context, &value, thix);
+				that.set_number().set_integer(mbw<Integer>(value));
 			}
-			else if (thix.is_string()) {
-				thix.to(that.set_string());
+			else if (quickjs::JS_IsNumber(thix)) {
+				auto value = double{};
+				quickjs::JS_ToFloat64(context, &value, thix);
+				that.set_number().set_floater(mbw<Floater>(value));
 			}
-			else if (thix.is_object_of_array()) {
-				thix.to(that.set_array());
+			else if (quickjs::JS_IsString(thix)) {
+				auto length = size_t{};
+				auto value = quickjs::JS_ToCStringLen(context, &length, thix);
+				that.set_string(make_string(value, length));
+				quickjs::JS_FreeCString(context, value);
 			}
-			else if (thix.is_object_of_object()) {
-				thix.to(that.set_object());
+			else if (quickjs::JS_IsArray(context, thix) == 1) {
+				auto length = int64_t{};
+				auto length_value = quickjs::JS_GetPropertyStr(context, thix, "length");
+				quickjs::JS_ToInt64(context, &length, length_value);
+				quickjs::JS_FreeValue(context, length_value);
+				auto & array = that.set_array();
+				array.allocate_full(mbw<Size>(static_cast<ZSize>(length)));
+				for (auto & index : SizeRange{array.size()}) {
+					auto element = quickjs::JS_GetPropertyUint32(context, thix, static_cast<uint32_t>(index.value));
+					auto final_element = make_finalizer([&] { quickjs::JS_FreeValue(context, element); });
+					take_value(context, object_prototype, element, array[index]);
+				}
+			}
+			else if (quickjs::JS_IsObject(thix) && is_plain_object(context, object_prototype, thix)) {
+				auto property_enum = ZPointer<quickjs::JSPropertyEnum>{};
+				auto property_count = uint32_t{};
+				quickjs::JS_GetOwnPropertyNames(context, &property_enum, &property_count, thix, quickjs::JS_GPN_STRING_MASK_);
+				auto final_property_enum = make_finalizer([&] { quickjs::js_free_prop_enum(context, property_enum, property_count); });
+				auto & object = that.set_object();
+				object.allocate_full(mbw<Size>(property_count));
+				for (auto & index : SizeRange{object.size()}) {
+					auto & property = property_enum[index.value];
+					auto   key = quickjs::JS_AtomToCString(context, property.atom);
+					object.at(index).key = make_string(key);
+					quickjs::JS_FreeCString(context, key);
+					auto element = quickjs::JS_GetProperty(context, thix, property.atom);
+					auto final_element = make_finalizer([&] { quickjs::JS_FreeValue(context, element); });
+					take_value(context, object_prototype, element, object.at(index).value);
+				}
 			}
 			else {
 				assert_fail(R"(/* thix type is valid */)");
@@ -1268,6 +1342,49 @@ namespace TwinStar::Kernel::JavaScript {
 			return;
 		}
 
+		static auto is_plain_object (
+			ZPointer<quickjs::JSContext> const & context,
+			quickjs::JSValue const &             object_prototype,
+			quickjs::JSValue const &             thix
+		) -> Boolean {
+			auto prototype = quickjs::JS_GetPrototype(context, thix);
+			auto result = mbw<Boolean>(JS_VALUE_GET_PTR(prototype) == JS_VALUE_GET_PTR(object_prototype));
+			quickjs::JS_FreeValue(context, prototype);
+			return result;
+		}
+
+		// ----------------
+
+		static auto from (
+			This &       thix,
+			That const & that
+		) -> Void {
+			auto context = thix._context();
+			auto atom_cache = AtomCache{};
+			auto final_atom_cache = make_finalizer(
+				[&] {
+					for (auto & element : atom_cache) {
+						quickjs::JS_FreeAtom(context, element.second);
+					}
+				}
+			);
+			thix._rebind_value(make_value(context, atom_cache, that));
+			return;
+		}
+
+		static auto to (
+			This & thix,
+			That & that
+		) -> Void {
+			auto context = thix._context();
+			auto object = quickjs::JS_NewObject(context);
+			auto object_prototype = quickjs::JS_GetPrototype(context, object);
+			quickjs::JS_FreeValue(context, object);
+			auto final_object_prototype = make_finalizer([&] { quickjs::JS_FreeValue(context, object_prototype); });
+			take_value(context, object_prototype, thix._value(), that);
+			return;
+		}
+
 	};
 
 	template <>
@@ -75,6 +75,20 @@ namespace TwinStar::Kernel::Trait {
 		&& (std::is_convertible_v<From, To>)
 		;
 
+	// ----------------
+
+	// NOTE
+	// an object is trivially relocatable if move it to a new place then destruct the source is equivalent to copy its byte
+	// trivially copyable type always is, container that only refer to its storage by pointer declare it by specialize k_trivially_relocatable
+	template <typename It>
+	inline constexpr auto k_trivially_relocatable = bool{std::is_trivially_copyable_v<It>};
+
+	template <typename It>
+	concept IsTriviallyRelocatable =
+		CategoryConstraint<IsPureInstance<It>>
+		&& (k_trivially_relocatable<It>)
+		;
+
 	#pragma endregion
 
 	#pragma region utility
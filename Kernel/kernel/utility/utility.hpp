@@ -110,6 +110,8 @@
 #include "kernel/utility/miscellaneous/constant_block.hpp"
 #include "kernel/utility/miscellaneous/string_block.hpp"
 #include "kernel/utility/miscellaneous/thread.hpp"
+#include "kernel/utility/miscellaneous/parallel.hpp"
+#include "kernel/utility/miscellaneous/trace.hpp"
 
 #include "kernel/utility/support/std.hpp"
 #include "kernel/utility/support/fmt.hpp"
@@ -43,6 +43,11 @@ MD5::MD5(const span<const byte>& message) {
   init(message.data(), message.size());
 }
 
+// TwinStar : insert
+void MD5::update(const span<const byte>& message) {
+  init(message.data(), message.size());
+}
+
 /**
  * @Generate md5 digest.
  *
@@ -97,6 +97,10 @@ public:
   // MD5(const string& message);
   MD5(const span<const byte>& message);
 
+  // TwinStar : insert
+  /* Process another message block. */
+  void update(const span<const byte>& message);
+
   /* Generate md5 digest. */
   const byte* getDigest();
 
@@ -30,6 +30,7 @@ end
 includes('./kernel')
 
 includes('./test')
+includes('./benchmark')
 if m.system:is('windows', 'linux', 'macintosh') then
 	includes('../ShellCLI/third/tinyfiledialogs')
 end
@@ -118,11 +118,17 @@ namespace TwinStar.Script.Executor.Implement.popcap.package_ {
 						automatic: null,
 						condition: null,
 					}),
+					typical_argument_boolean({
+						id: 'encrypted',
+						checker: null,
+						automatic: null,
+						condition: null,
+					}),
 				],
-				worker: ({ data_file, bundle_directory, version_number, version_compress_resource_data }) => {
+				worker: ({ data_file, bundle_directory, version_number, version_compress_resource_data, encrypted }) => {
 					let definition_file = `${bundle_directory}/definition.json`;
 					let resource_directory = `${bundle_directory}/resource`;
-					KernelX.Tool.PopCap.Package.unpack_fs(data_file, definition_file, resource_directory, { number: version_number as any, compress_resource_data: version_compress_resource_data });
+					KernelX.Tool.PopCap.Package.unpack_fs(data_file, definition_file, resource_directory, { number: version_number as any, compress_resource_data: version_compress_resource_data }, !encrypted ? [] : [0xF7n]);
 					return;
 				},
 				batch_argument: [
@@ -885,6 +885,60 @@ declare namespace TwinStar.Kernel {
 
 		}
 
+		/** 图像尺寸列表 */
+		class ImageSizeList {
+
+			// ------------------------------------------------
+
+			private _Image_ImageSizeList;
+
+			// ------------------------------------------------
+
+			static default(): ImageSizeList;
+
+			static copy(it: ImageSizeList): ImageSizeList;
+
+			// ------------------------------------------------
+
+			static Value: Array<[bigint, bigint]>;
+
+			static value(it: typeof ImageSizeList.Value): ImageSizeList;
+
+			get value(): typeof ImageSizeList.Value;
+
+			set value(it: typeof ImageSizeList.Value);
+
+			// ------------------------------------------------
+
+		}
+
+		/** 图像位置列表 */
+		class ImagePositionList {
+
+			// ------------------------------------------------
+
+			private _Image_ImagePositionList;
+
+			// ------------------------------------------------
+
+			static default(): ImagePositionList;
+
+			static copy(it: ImagePositionList): ImagePositionList;
+
+			// ------------------------------------------------
+
+			static Value: Array<[bigint, bigint]>;
+
+			static value(it: typeof ImagePositionList.Value): ImagePositionList;
+
+			get value(): typeof ImagePositionList.Value;
+
+			set value(it: typeof ImagePositionList.Value);
+
+			// ------------------------------------------------
+
+		}
+
 		// ------------------------------------------------
 
 		/** 颜色 */
@@ -1249,6 +1303,19 @@ declare namespace TwinStar.Kernel {
 			target: Path,
 		): ByteArray;
 
+		/**
+		 * 读取文件的一部分至一个新的字节序列容器
+		 * @param target 目标文件
+		 * @param offset 起始偏移
+		 * @param size 读取尺寸
+		 * @returns 文件内容
+		 */
+		function read_file_part(
+			target: Path,
+			offset: Size,
+			size: Size,
+		): ByteArray;
+
 		/**
 		 * 将字节序列写入文件
 		 * @param target 目标文件
@@ -1532,6 +1599,20 @@ declare namespace TwinStar.Kernel {
 							bit_count: BitCount,
 						): Void;
 
+						/**
+						 * 散列文件，分块读取而无需载入整个文件
+						 * @param data_file 数据文件
+						 * @param value 散列值
+						 * @param mode 模式
+						 * @param bit_count 位数
+						 */
+						function process_file(
+							data_file: Path,
+							value: ByteArray,
+							mode: Mode,
+							bit_count: BitCount,
+						): Void;
+
 					}
 
 				}
@@ -1552,6 +1633,16 @@ declare namespace TwinStar.Kernel {
 							value: ByteArray,
 						): Void;
 
+						/**
+						 * 散列文件，分块读取而无需载入整个文件
+						 * @param data_file 数据文件
+						 * @param value 散列值
+						 */
+						function process_file(
+							data_file: Path,
+							value: ByteArray,
+						): Void;
+
 					}
 
 				}
@@ -2068,6 +2159,33 @@ declare namespace TwinStar.Kernel {
 			/** 变换 */
 			namespace Transformation {
 
+				/** 缩放方法 */
+				class ScaleMethod {
+
+					// ------------------------------------------------
+
+					private _Tool_Texture_Transformation_ScaleMethod;
+
+					// ------------------------------------------------
+
+					static default(): ScaleMethod;
+
+					static copy(it: ScaleMethod): ScaleMethod;
+
+					// ------------------------------------------------
+
+					static Value: 'avir' | 'bilinear' | 'box';
+
+					static value(it: typeof ScaleMethod.Value): ScaleMethod;
+
+					get value(): typeof ScaleMethod.Value;
+
+					set value(it: typeof ScaleMethod.Value);
+
+					// ------------------------------------------------
+
+				}
+
 				/** 翻转 */
 				namespace Flip {
 
@@ -2092,10 +2210,12 @@ declare namespace TwinStar.Kernel {
 					 * 缩放
 					 * @param source 来源
 					 * @param destination 目的
+					 * @param method 方法；avir 质量最高，bilinear 与 box 速度更快，box 适用于整数倍缩小
 					 */
 					function process(
 						source: Image.CImageView,
 						destination: Image.VImageView,
+						method: ScaleMethod,
 					): Void;
 
 				}
@@ -2292,6 +2412,33 @@ declare namespace TwinStar.Kernel {
 				/** PNG */
 				namespace PNG {
 
+					/** 写入力度 */
+					class Effort {
+
+						// ------------------------------------------------
+
+						private _Tool_Texture_File_PNG_Effort;
+
+						// ------------------------------------------------
+
+						static default(): Effort;
+
+						static copy(it: Effort): Effort;
+
+						// ------------------------------------------------
+
+						static Value: 'fast' | 'default_mode' | 'best';
+
+						static value(it: typeof Effort.Value): Effort;
+
+						get value(): typeof Effort.Value;
+
+						set value(it: typeof Effort.Value);
+
+						// ------------------------------------------------
+
+					}
+
 					/** 写 */
 					namespace Write {
 
@@ -2299,10 +2446,22 @@ declare namespace TwinStar.Kernel {
 						 * 写
 						 * @param data 数据
 						 * @param image 图像
+						 * @param effort 力度；default_mode 使用libpng默认设置，fast 使用Sub过滤与1级压缩，best 逐行自适应过滤与9级压缩；fast与best均分块并行压缩
 						 */
 						function process(
 							data: OByteStreamView,
 							image: Image.CImageView,
+							effort: Effort,
+						): Void;
+
+						/**
+						 * 计算数据大小上限
+						 * @param image_size 图像尺寸
+						 * @param data_size_bound 数据大小上限
+						 */
+						function estimate(
+							image_size: Image.ImageSize,
+							data_size_bound: Size,
 						): Void;
 
 					}
@@ -2320,6 +2479,16 @@ declare namespace TwinStar.Kernel {
 							image: Image.VImageView,
 						): Void;
 
+						/**
+						 * 读，依据文件头分配图像，头部与像素数据一次性解析
+						 * @param data 数据
+						 * @param image 图像
+						 */
+						function process_of(
+							data: IByteStreamView,
+							image: Image.Image,
+						): Void;
+
 						/**
 						 * 计算图像尺寸
 						 * @param data 数据
@@ -2336,6 +2505,141 @@ declare namespace TwinStar.Kernel {
 
 			}
 
+			/** 图集 */
+			namespace Atlas {
+
+				/** 扩展方式 */
+				class ExpandMethod {
+
+					// ------------------------------------------------
+
+					private _Tool_Texture_Atlas_ExpandMethod;
+
+					// ------------------------------------------------
+
+					static default(): ExpandMethod;
+
+					static copy(it: ExpandMethod): ExpandMethod;
+
+					// ------------------------------------------------
+
+					static Value: 'exponent_of_2' | 'fixed';
+
+					static value(it: typeof ExpandMethod.Value): ExpandMethod;
+
+					get value(): typeof ExpandMethod.Value;
+
+					set value(it: typeof ExpandMethod.Value);
+
+					// ------------------------------------------------
+
+				}
+
+				/** 打包 */
+				namespace Pack {
+
+					/**
+					 * 打包
+					 * @param item 子项尺寸
+					 * @param container 容器尺寸
+					 * @param item_position 子项位置
+					 * @param expand_method 容器扩展方式
+					 * @param expand_square 容器保持正方形
+					 * @param expand_value 容器扩展值，仅用于 fixed 方式
+					 */
+					function process(
+						item: Image.ImageSizeList,
+						container: Image.ImageSize,
+						item_position: Image.ImagePositionList,
+						expand_method: ExpandMethod,
+						expand_square: Boolean,
+						expand_value: Size,
+					): Void;
+
+				}
+
+				/** 定义 */
+				namespace Definition {
+
+					/** 图集 */
+					class Atlas {
+
+						// ------------------------------------------------
+
+						private _Tool_Texture_Atlas_Definition_Atlas;
+
+						// ------------------------------------------------
+
+						static default(): Atlas;
+
+						static copy(it: Atlas): Atlas;
+
+						// ------------------------------------------------
+
+						static Value: {
+							/** 尺寸 */
+							size: [bigint, bigint];
+							/** 子图 */
+							sprite: Array<{
+								/** 名称 */
+								name: string;
+								/** 位置 */
+								position: [bigint, bigint];
+								/** 尺寸 */
+								size: [bigint, bigint];
+							}>;
+						};
+
+						static value(it: typeof Atlas.Value): Atlas;
+
+						get value(): typeof Atlas.Value;
+
+						set value(it: typeof Atlas.Value);
+
+						// ------------------------------------------------
+
+					}
+
+				}
+
+				/** 合成 */
+				namespace Compose {
+
+					/**
+					 * 合成，并行读取子图 PNG 文件，尺寸与定义不符的子图将被裁剪
+					 * @param atlas 图集
+					 * @param definition 定义
+					 * @param sprite_directory 子图目录
+					 */
+					function process(
+						atlas: Image.VImageView,
+						definition: Definition.Atlas,
+						sprite_directory: Path,
+					): Void;
+
+				}
+
+				/** 拆分 */
+				namespace Split {
+
+					/**
+					 * 拆分，并行写入子图 PNG 文件
+					 * @param atlas 图集
+					 * @param definition 定义，启用裁边时子图位置与尺寸将被更新
+					 * @param sprite_directory 子图目录
+					 * @param trim 裁去透明边缘
+					 */
+					function process(
+						atlas: Image.CImageView,
+						definition: Definition.Atlas,
+						sprite_directory: Path,
+						trim: Boolean,
+					): Void;
+
+				}
+
+			}
+
 		}
 
 		/** Wwise */
@@ -2582,6 +2886,34 @@ declare namespace TwinStar.Kernel {
 						version: Version,
 					): Void;
 
+					/**
+					 * 解包指定资源，仅解压其所引用的块
+					 * @param data 数据
+					 * @param resource 资源路径
+					 * @param resource_directory 资源目录
+					 * @param version 版本
+					 */
+					function process_partial(
+						data: IByteStreamView,
+						resource: PathList,
+						resource_directory: Path,
+						version: Version,
+					): Void;
+
+					/**
+					 * 从文件解包指定资源，仅读取信息段与其所引用的块
+					 * @param data_file 数据文件
+					 * @param resource 资源路径
+					 * @param resource_directory 资源目录
+					 * @param version 版本
+					 */
+					function process_file_partial(
+						data_file: Path,
+						resource: PathList,
+						resource_directory: Path,
+						version: Version,
+					): Void;
+
 				}
 
 			}
@@ -3301,6 +3633,78 @@ declare namespace TwinStar.Kernel {
 
 				}
 
+				/** 转换 */
+				namespace Convert {
+
+					/** Flash */
+					namespace Flash {
+
+						namespace JS_N {
+
+							type WorkAreaExtraInformation = [bigint, bigint];
+
+							type ImageExtraInformation = {
+								name: string;
+								size: [bigint, bigint];
+							};
+
+							type SpriteExtraInformation = {
+								name: string;
+								frame_rate: number;
+								work_area: null | WorkAreaExtraInformation;
+							};
+
+							type ExtraInformation = {
+								position: [number, number];
+								image: Array<ImageExtraInformation>;
+								sprite: Array<SpriteExtraInformation>;
+								main_sprite: null | SpriteExtraInformation;
+							};
+
+						}
+
+						/** 从 */
+						namespace From {
+
+							/**
+							 * 转换为Flash
+							 * @param definition 定义
+							 * @param extra 附加信息
+							 * @param directory 目录
+							 * @param version 版本
+							 */
+							function process(
+								definition: Definition.Animation,
+								extra: JSON.Value<JS_N.ExtraInformation>,
+								directory: Path,
+								version: Version,
+							): Void;
+
+						}
+
+						/** 到 */
+						namespace To {
+
+							/**
+							 * 从Flash转换
+							 * @param definition 定义
+							 * @param extra 附加信息
+							 * @param directory 目录
+							 * @param version 版本
+							 */
+							function process(
+								definition: Definition.Animation,
+								extra: JSON.Value<JS_N.ExtraInformation>,
+								directory: Path,
+								version: Version,
+							): Void;
+
+						}
+
+					}
+
+				}
+
 			}
 
 			/** ReAnimation */
@@ -4046,12 +4450,14 @@ declare namespace TwinStar.Kernel {
 					 * @param data 数据
 					 * @param definition 定义
 					 * @param resource_directory 资源目录
+					 * @param key 异或密钥；非空时在解析过程中同步解密，为空则视为明文
 					 * @param version 版本
 					 */
 					function process(
 						data: IByteStreamView,
 						definition: Definition.Package,
 						resource_directory: PathOptional,
+						key: CByteListView,
 						version: Version,
 					): Void;
 
@@ -4215,6 +4621,41 @@ declare namespace TwinStar.Kernel {
 
 				}
 
+				/** 子包缓存，以资源束内容散列与子组索引为键，按最近最少使用淘汰已解压的资源数据段 */
+				namespace PacketCache {
+
+					/**
+					 * 获取缓存容量上限
+					 * @returns 容量上限，为0时表示禁用缓存
+					 */
+					function budget(
+					): Size;
+
+					/**
+					 * 获取缓存当前占用
+					 * @returns 当前占用
+					 */
+					function usage(
+					): Size;
+
+					/**
+					 * 设置缓存容量上限，超出上限的缓存项将被淘汰
+					 * @param budget 容量上限，为0时表示禁用缓存
+					 * @returns 无
+					 */
+					function set_budget(
+						budget: Size,
+					): Void;
+
+					/**
+					 * 清空缓存
+					 * @returns 无
+					 */
+					function clear(
+					): Void;
+
+				}
+
 			}
 
 			/** ResourceStreamBundle */
@@ -4403,6 +4844,88 @@ declare namespace TwinStar.Kernel {
 
 				}
 
+				/** 索引 */
+				namespace Index {
+
+					namespace JS_N {
+
+						/** 纹理资源 */
+						type TextureResource = {
+							/** 尺寸 */
+							size: [bigint, bigint];
+							/** 格式 */
+							format: bigint;
+							/** 行字节数 */
+							pitch: bigint;
+							/** 附加字节数。当 version.extended_texture_information_for_pvz2_cn >= 1 时存在 */
+							additional_byte_count?: bigint;
+							/** 缩放。当 version.extended_texture_information_for_pvz2_cn >= 2 时存在 */
+							scale?: bigint;
+						};
+
+						/** 子群 */
+						type Subgroup = {
+							/** ID */
+							id: string;
+							/** 类别 */
+							category: Definition.JS_N.SubgroupCategory;
+							/** 压缩 */
+							compression: Definition.JS_N.PacketCompression;
+							/** 子包在资源束中的偏移 */
+							offset: bigint;
+							/** 子包尺寸 */
+							size: bigint;
+							/** 资源路径 */
+							resource: Array<string>;
+							/** 纹理资源 */
+							texture_resource: Array<TextureResource>;
+						};
+
+						/** 群 */
+						type Group = {
+							/** ID */
+							id: string;
+							/** 是否为复合群 */
+							composite: boolean;
+							/** 子群 */
+							subgroup: Array<Subgroup>;
+						};
+
+						/** 包 */
+						type Package = {
+							/** 群 */
+							group: Array<Group>;
+						};
+
+					}
+
+					/** 包 */
+					class Package {
+
+						// ------------------------------------------------
+
+						private _Tool_PopCap_ResourceStreamBundle_Index_Package;
+
+						// ------------------------------------------------
+
+						static default(): Package;
+
+						static copy(it: Package): Package;
+
+						// ------------------------------------------------
+
+						static json(it: JSON.Value<JS_N.Package>, version: Version): Package;
+
+						get_json(version: Version): JSON.Value<JS_N.Package>;
+
+						set_json(it: JSON.Value<JS_N.Package>, version: Version): Void;
+
+						// ------------------------------------------------
+
+					}
+
+				}
+
 				/** 打包 */
 				namespace Pack {
 
@@ -4426,6 +4949,26 @@ declare namespace TwinStar.Kernel {
 						version: Version,
 					): Void;
 
+					/**
+					 * 打包，逐个子包写入文件，最后回填信息段
+					 * @param data_file 数据文件
+					 * @param definition 定义
+					 * @param manifest 清单
+					 * @param resource_directory 资源目录
+					 * @param packet_file 子包文件
+					 * @param new_packet_file 新生成子包文件
+					 * @param version 版本
+					 */
+					function process_file(
+						data_file: Path,
+						definition: Definition.Package,
+						manifest: Manifest.PackageOptional,
+						resource_directory: Path,
+						packet_file: PathOptional,
+						new_packet_file: PathOptional,
+						version: Version,
+					): Void;
+
 				}
 
 				/** 解包 */
@@ -4449,6 +4992,30 @@ declare namespace TwinStar.Kernel {
 						version: Version,
 					): Void;
 
+					/**
+					 * 仅解析信息段，生成索引，不读取子包数据
+					 * @param data 数据
+					 * @param index 索引
+					 * @param version 版本
+					 */
+					function process_index(
+						data: IByteStreamView,
+						index: Index.Package,
+						version: Version,
+					): Void;
+
+					/**
+					 * 仅从文件中读取信息段，生成索引，不读取子包数据
+					 * @param data_file 数据文件
+					 * @param index 索引
+					 * @param version 版本
+					 */
+					function process_index_file(
+						data_file: Path,
+						index: Index.Package,
+						version: Version,
+					): Void;
+
 				}
 
 			}
@@ -4671,6 +5238,44 @@ declare namespace TwinStar.Kernel {
 
 			}
 
+			/** PvZ-2资源清单（NewTypeObjectNotation二进制格式） */
+			namespace PvZ2ResourceManifest {
+
+				/** 清单定义，与脚本中的 ResourceManifest.Package 相同 */
+				type JS_Definition = { [key: string]: JSON.JS_Value; };
+
+				/** 编码 */
+				namespace Encode {
+
+					/**
+					 * 编码
+					 * @param data 数据
+					 * @param definition 定义
+					 */
+					function process(
+						data: OByteStreamView,
+						definition: JSON.Value<JS_Definition>,
+					): Void;
+
+				}
+
+				/** 解码 */
+				namespace Decode {
+
+					/**
+					 * 解码
+					 * @param data 数据
+					 * @param definition 定义
+					 */
+					function process(
+						data: IByteStreamView,
+						definition: JSON.Value<JS_Definition>,
+					): Void;
+
+				}
+
+			}
+
 		}
 
 	}
@@ -4858,6 +5463,62 @@ declare namespace TwinStar.Kernel {
 
 		// ------------------------------------------------
 
+		/** 追踪 */
+		namespace Tracer {
+
+			/** 汇总 */
+			type JS_Summary = {
+				span: Array<{
+					name: string;
+					count: bigint;
+					duration: bigint;
+					duration_maximum: bigint;
+					byte_in: bigint;
+					byte_out: bigint;
+				}>;
+				thread_count: bigint;
+				dropped_event_count: bigint;
+			};
+
+			/**
+			 * 判断是否启用追踪
+			 * @returns 是否启用
+			 */
+			function enabled(
+			): Boolean;
+
+			/**
+			 * 启用或禁用追踪
+			 * @param enabled 是否启用
+			 */
+			function set_enabled(
+				enabled: Boolean,
+			): Void;
+
+			/**
+			 * 清空已记录的事件，并重置时间原点
+			 */
+			function clear(
+			): Void;
+
+			/**
+			 * 按名称汇总已记录的区间，时长以微秒为单位
+			 * @returns 汇总
+			 */
+			function summary(
+			): JSON.Value<JS_Summary>;
+
+			/**
+			 * 导出为Chrome trace-event格式
+			 * @returns 追踪数据
+			 */
+			function export_chrome_trace(
+			): JSON.Value;
+
+		}
+
+		// ------------------------------------------------
+
 		/** 版本编号 */
 		const g_version: Size;
 
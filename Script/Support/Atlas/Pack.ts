@@ -20,9 +20,7 @@ namespace TwinStar.Script.Support.Atlas.Pack {
 		atlas: Kernel.Image.ImageView,
 		sprite_directory: string,
 	): void {
-		for (let sprite_definition of definition.sprite) {
-			KernelX.Image.File.PNG.read_fs(`${sprite_directory}/${sprite_definition.name}.png`, atlas.sub(Kernel.Image.ImagePosition.value(sprite_definition.position), Kernel.Image.ImageSize.value(sprite_definition.size)));
-		}
+		Kernel.Tool.Texture.Atlas.Compose.process(atlas, Kernel.Tool.Texture.Atlas.Definition.Atlas.value(definition), Kernel.Path.value(sprite_directory));
 		return;
 	}
 
@@ -30,9 +28,12 @@ namespace TwinStar.Script.Support.Atlas.Pack {
 		definition: AtlasDefinition,
 		atlas: Kernel.Image.CImageView,
 		sprite_directory: string,
+		trim: boolean = false,
 	): void {
-		for (let sprite_definition of definition.sprite) {
-			KernelX.Image.File.PNG.write_fs(`${sprite_directory}/${sprite_definition.name}.png`, atlas.sub(Kernel.Image.ImagePosition.value(sprite_definition.position), Kernel.Image.ImageSize.value(sprite_definition.size)));
+		let definition_native = Kernel.Tool.Texture.Atlas.Definition.Atlas.value(definition);
+		Kernel.Tool.Texture.Atlas.Split.process(atlas, definition_native, Kernel.Path.value(sprite_directory), Kernel.Boolean.value(trim));
+		if (trim) {
+			definition.sprite = definition_native.value.sprite;
 		}
 		return;
 	}
@@ -46,7 +47,7 @@ namespace TwinStar.Script.Support.Atlas.Pack {
 			let size = KernelX.Image.File.PNG.size_fs(`${sprite_directory}/${value}.png`);
 			return [value, { w: Number(size[0]), h: Number(size[1]) }];
 		});
-		let [atlas_box, sprite_rect] = PackAutomatic.pack_automatic_best(sprite_box, expand_value === 'exponent_of_2' ? PackAutomatic.expander_exponent_of_2_generator(false) : PackAutomatic.expander_fixed_generator(false, expand_value));
+		let [atlas_box, sprite_rect] = PackAutomatic.pack_automatic_best_native(sprite_box, expand_value);
 		let definition: AtlasDefinition = {
 			size: [BigInt(atlas_box.w), BigInt(atlas_box.h)],
 			sprite: [],
@@ -61,9 +62,8 @@ namespace TwinStar.Script.Support.Atlas.Pack {
 				size: [BigInt(rect.w), BigInt(rect.h)],
 			};
 			definition.sprite.push(sprite_definition);
-			let sprite = atlas_view.sub(Kernel.Image.ImagePosition.value(sprite_definition.position), Kernel.Image.ImageSize.value(sprite_definition.size));
-			KernelX.Image.File.PNG.read_fs(`${sprite_directory}/${sprite_file}.png`, sprite);
 		}
+		pack_fsh(definition, atlas_view, sprite_directory);
 		return [definition, atlas];
 	}
 
@@ -219,4 +219,32 @@ namespace TwinStar.Script.Support.Atlas.PackAutomatic {
 
 	// ------------------------------------------------
 
-}
\ No newline at end of file
+	export function pack_automatic_best_native(
+		item_map: Record<string, Box>,
+		expand_value: number | 'exponent_of_2',
+		expand_square: boolean = false,
+	): [Box, Record<string, Rect>] {
+		let item_name_list = Object.keys(item_map);
+		let item = Kernel.Image.ImageSizeList.value(item_name_list.map((value) => ([BigInt(item_map[value].w), BigInt(item_map[value].h)])));
+		let container = Kernel.Image.ImageSize.default();
+		let item_position = Kernel.Image.ImagePositionList.default();
+		Kernel.Tool.Texture.Atlas.Pack.process(
+			item,
+			container,
+			item_position,
+			Kernel.Tool.Texture.Atlas.ExpandMethod.value(expand_value === 'exponent_of_2' ? 'exponent_of_2' : 'fixed'),
+			Kernel.Boolean.value(expand_square),
+			Kernel.Size.value(BigInt(expand_value === 'exponent_of_2' ? 0 : expand_value)),
+		);
+		let container_value = container.value;
+		let item_position_value = item_position.value;
+		let result: Record<string, Rect> = {};
+		item_name_list.forEach((value, index) => {
+			result[value] = { x: Number(item_position_value[index][0]), y: Number(item_position_value[index][1]), ...item_map[value] };
+		});
+		return [{ w: Number(container_value[0]), h: Number(container_value[1]) }, result];
+	}
+
+	// ------------------------------------------------
+
+}
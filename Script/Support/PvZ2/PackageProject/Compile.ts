@@ -223,11 +223,11 @@ namespace TwinStar.Script.Support.PvZ2.PackageProject.Compile {
 							];
 							let current_sprite = Kernel.Image.Image.allocate(Kernel.Image.ImageSize.value(current_sprite_size));
 							let current_sprite_view = current_sprite.view();
-							Kernel.Tool.Texture.Transformation.Scale.process(sprite_view, current_sprite_view);
+							KernelX.Tool.Texture.Transformation.scale(sprite_view, current_sprite_view);
 						}
 					}
 					let sprite_item_map = record_transform(sprite_list, (key, value) => ([key, { w: Number(value[1].size().value[0]), h: Number(value[1].size().value[1]) }]));
-					let [atlas_box, sprite_rect_list] = Support.Atlas.PackAutomatic.pack_automatic_best(sprite_item_map, Support.Atlas.PackAutomatic.expander_exponent_of_2_generator(false));
+					let [atlas_box, sprite_rect_list] = Support.Atlas.PackAutomatic.pack_automatic_best_native(sprite_item_map, 'exponent_of_2');
 					let atlas_size = PopCap.Texture.Encoding.compute_padded_image_size([BigInt(atlas_box.w), BigInt(atlas_box.h)], conversion_setting.format);
 					let atlas = Kernel.Image.Image.allocate(Kernel.Image.ImageSize.value(atlas_size));
 					let atlas_view = atlas.view();
@@ -2,6 +2,32 @@ namespace TwinStar.Script.Support.PvZ2.PackageProject.Link {
 
 	// ------------------------------------------------
 
+	function compute_manifest_size_bound(
+		value: any,
+	): bigint {
+		if (typeof value === 'string') {
+			return 16n + BigInt(value.length) * 3n;
+		}
+		if (typeof value !== 'object' || value === null) {
+			return 16n;
+		}
+		let result = value instanceof Array ? 16n : 128n;
+		for (let key in value) {
+			result += compute_manifest_size_bound(key) + compute_manifest_size_bound(value[key]);
+		}
+		return result;
+	}
+
+	function allocate_manifest_buffer(
+		manifest: any,
+		buffer_size: bigint,
+	): Kernel.ByteArray {
+		let size = compute_manifest_size_bound(manifest) + 0x1000n;
+		return Kernel.ByteArray.allocate(Kernel.Size.value(size < buffer_size ? size : buffer_size));
+	}
+
+	// ------------------------------------------------
+
 	export function link(
 		project_directory: string,
 		target_package: null | Array<string>,
@@ -9,7 +35,6 @@ namespace TwinStar.Script.Support.PvZ2.PackageProject.Link {
 		buffer_size: bigint,
 	): void {
 		check_version_file(project_directory);
-		let buffer = Kernel.ByteArray.allocate(Kernel.Size.value(buffer_size));
 		let project_setting = KernelX.JSON.read_fs_js(make_scope_setting_path(project_directory)) as ProjectSetting;
 		for (let package_setting of project_setting.package) {
 			if (target_package !== null && !target_package.includes(package_setting.name)) {
@@ -120,6 +145,7 @@ namespace TwinStar.Script.Support.PvZ2.PackageProject.Link {
 						manifesr_resource_path += '.rton';
 						let manifest = RegularResourceManifest.Convert.to_official(package_manifest, package_setting.manifest.type === 'external_rton_with_array_path');
 						let version_c = Kernel.Tool.PopCap.ReflectionObjectNotation.Version.value({ number: 1n, native_string_encoding_use_utf8: true });
+						let buffer = allocate_manifest_buffer(manifest, buffer_size);
 						let stream = Kernel.ByteStreamView.watch(buffer.view());
 						Kernel.Tool.PopCap.ReflectionObjectNotation.Encode.process(stream, Kernel.JSON.Value.value(manifest as any), Kernel.Boolean.value(true), Kernel.Boolean.value(true), version_c);
 						KernelX.FileSystem.write_file(`${package_bundle_directory}/resource/${manifesr_resource_path}`, stream.stream_view());
@@ -127,6 +153,7 @@ namespace TwinStar.Script.Support.PvZ2.PackageProject.Link {
 					if (package_setting.manifest.type === 'external_newton') {
 						manifesr_resource_path += '.newton';
 						let manifest = RegularResourceManifest.Convert.to_official(package_manifest, false);
+						let buffer = allocate_manifest_buffer(manifest, buffer_size);
 						let stream = new ByteStreamView(buffer.view().value);
 						ResourceManifest.NewTypeObjectNotation.Encode.process(stream, manifest);
 						KernelX.FileSystem.write_file(`${package_bundle_directory}/resource/${manifesr_resource_path}`, stream.sub(0, stream.p()));
@@ -166,7 +193,7 @@ namespace TwinStar.Script.Support.PvZ2.PackageProject.Link {
 			let manifest_file = `${bundle_directory}/manifest.json`;
 			let resource_directory = `${bundle_directory}/resource`;
 			let packet_file = `${bundle_directory}/packet/{1}.rsg`;
-			KernelX.Tool.PopCap.ResourceStreamBundle.pack_fs(data_file, definition_file, manifest_file, resource_directory, packet_file, packet_file, package_setting.version, buffer.view());
+			KernelX.Tool.PopCap.ResourceStreamBundle.pack_fs(data_file, definition_file, manifest_file, resource_directory, packet_file, packet_file, package_setting.version, null);
 		}
 		return;
 	}
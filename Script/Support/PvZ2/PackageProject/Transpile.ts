@@ -151,7 +151,7 @@ namespace TwinStar.Script.Support.PvZ2.PackageProject.Transpile {
 					}
 					let sprite_list = source_list;
 					let sprite_item_map = record_transform(sprite_list, (key, value) => ([key, { w: Number(value[0].size().value[0]), h: Number(value[0].size().value[1]) }]));
-					let [atlas_box, sprite_rect_list] = Support.Atlas.PackAutomatic.pack_automatic_best(sprite_item_map, Support.Atlas.PackAutomatic.expander_exponent_of_2_generator(false));
+					let [atlas_box, sprite_rect_list] = Support.Atlas.PackAutomatic.pack_automatic_best_native(sprite_item_map, 'exponent_of_2');
 					let atlas_size = PopCap.Texture.Encoding.compute_padded_image_size([BigInt(atlas_box.w), BigInt(atlas_box.h)], conversion_setting.format);
 					let atlas = Kernel.Image.Image.allocate(Kernel.Image.ImageSize.value(atlas_size));
 					let atlas_view = atlas.view();
@@ -171,9 +171,7 @@ namespace TwinStar.Script.Support.PvZ2.ResourceManifest.NewTypeObjectNotation.De
 		data_file: string,
 		definition_file: string,
 	): void {
-		let data = KernelX.FileSystem.read_file(data_file);
-		let definition = process(new ByteStreamView(data.view().value));
-		KernelX.JSON.write_fs_js(definition_file, definition);
+		KernelX.Tool.Miscellaneous.PvZ2ResourceManifest.decode_fs(data_file, definition_file);
 		return;
 	}
 
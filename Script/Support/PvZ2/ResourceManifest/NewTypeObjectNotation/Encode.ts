@@ -30,9 +30,9 @@ namespace TwinStar.Script.Support.PvZ2.ResourceManifest.NewTypeObjectNotation.En
 		data: ByteStreamView,
 		value: string,
 	): void {
-		data.i32(BigInt(value.length));
 		let string_c = Kernel.String.value(value);
 		let string_view = new Uint8Array(Kernel.Miscellaneous.cast_CharacterListView_to_ByteListView(Kernel.Miscellaneous.cast_String_to_CharacterListView(string_c)).value);
+		data.i32(BigInt(string_view.length));
 		for (let index = 0; index < string_view.length; index++) {
 			data.u8(BigInt(string_view[index]));
 		}
@@ -108,12 +108,7 @@ namespace TwinStar.Script.Support.PvZ2.ResourceManifest.NewTypeObjectNotation.En
 		definition_file: string,
 		data_buffer: Kernel.ByteListView | bigint,
 	): void {
-		let data_buffer_if = is_bigint(data_buffer) ? Kernel.ByteArray.allocate(Kernel.Size.value(data_buffer)) : null;
-		let data_buffer_view = data_buffer instanceof Kernel.ByteListView ? data_buffer : data_buffer_if!.view();
-		let definition = KernelX.JSON.read_fs_js<ResourceManifest.Package>(definition_file);
-		let stream = new ByteStreamView(data_buffer_view.value);
-		process(stream, definition);
-		KernelX.FileSystem.write_file(data_file, data_buffer_view.sub(Kernel.Size.value(0n), Kernel.Size.value(BigInt(stream.p()))));
+		KernelX.Tool.Miscellaneous.PvZ2ResourceManifest.encode_fs(data_file, definition_file, data_buffer);
 		return;
 	}
 
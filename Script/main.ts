@@ -220,7 +220,6 @@ namespace TwinStar.Script {
 			`Support/Wwise/Media/Decode`,
 			`Support/PopCap/ReflectionObjectNotation/DecodeLenient`,
 			`Support/PopCap/Texture/Encoding`,
-			`Support/PopCap/Animation/Convert/common`,
 			`Support/PopCap/Animation/Convert/Flash/common`,
 			`Support/PopCap/Animation/Convert/Flash/From`,
 			`Support/PopCap/Animation/Convert/Flash/To`,
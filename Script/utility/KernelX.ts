@@ -241,11 +241,14 @@ namespace TwinStar.Script.KernelX {
 					return Kernel.Tool.Texture.File.PNG.Read.process(data, image);
 				}
 
+				export type Effort = typeof Kernel.Tool.Texture.File.PNG.Effort.Value;
+
 				export function write(
 					data: Kernel.ByteStreamView,
 					image: Kernel.Image.CImageView,
+					effort: Effort = 'default_mode',
 				): void {
-					return Kernel.Tool.Texture.File.PNG.Write.process(data, image);
+					return Kernel.Tool.Texture.File.PNG.Write.process(data, image, Kernel.Tool.Texture.File.PNG.Effort.value(effort));
 				}
 
 				// ------------------------------------------------
@@ -273,11 +276,12 @@ namespace TwinStar.Script.KernelX {
 					file: string,
 					image: Kernel.Image.CImageView,
 					data_buffer: Kernel.ByteListView | bigint = g_common_buffer.view(),
+					effort: Effort = 'default_mode',
 				): void {
 					let data = is_bigint(data_buffer) ? Kernel.ByteArray.allocate(Kernel.Size.value(data_buffer)) : null;
 					let data_view = data_buffer instanceof Kernel.ByteListView ? data_buffer : data!.view();
 					let data_stream = Kernel.ByteStreamView.watch(data_view);
-					write(data_stream, image);
+					write(data_stream, image, effort);
 					FileSystem.write_file(file, data_stream.stream_view());
 					return;
 				}
@@ -287,9 +291,8 @@ namespace TwinStar.Script.KernelX {
 				): Kernel.Image.Image {
 					let data = FileSystem.read_file(file);
 					let data_stream = Kernel.ByteStreamView.watch(data.view());
-					let image_size = size(data.view());
-					let image = Kernel.Image.Image.allocate(Kernel.Image.ImageSize.value(image_size));
-					read(data_stream, image.view());
+					let image = Kernel.Image.Image.default();
+					Kernel.Tool.Texture.File.PNG.Read.process_of(data_stream, image);
 					return image;
 				}
 
@@ -557,6 +560,44 @@ namespace TwinStar.Script.KernelX {
 
 	}
 
+	export namespace Miscellaneous {
+
+		export namespace Tracer {
+
+			// ------------------------------------------------
+
+			export function set_enabled(
+				enabled: boolean,
+			): void {
+				return Kernel.Miscellaneous.Tracer.set_enabled(Kernel.Boolean.value(enabled));
+			}
+
+			export function clear(
+			): void {
+				return Kernel.Miscellaneous.Tracer.clear();
+			}
+
+			// ------------------------------------------------
+
+			export function summary(
+			): Kernel.Miscellaneous.Tracer.JS_Summary {
+				return Kernel.Miscellaneous.Tracer.summary().value;
+			}
+
+			export function export_chrome_trace_fs(
+				data_file: string,
+				data_buffer: Kernel.CharacterListView | bigint = Kernel.Miscellaneous.cast_ByteListView_to_CharacterListView(g_common_buffer.view()),
+			): void {
+				JSON.write_fs(data_file, Kernel.Miscellaneous.Tracer.export_chrome_trace(), true, true, true, true, data_buffer);
+				return;
+			}
+
+			// ------------------------------------------------
+
+		}
+
+	}
+
 	export namespace Tool {
 
 		export namespace Data {
@@ -568,9 +609,8 @@ namespace TwinStar.Script.KernelX {
 					export function hash_fs(
 						data_file: string,
 					): bigint {
-						let data = FileSystem.read_file(data_file);
 						let value = Kernel.ByteArray.default();
-						Kernel.Tool.Data.Hash.MD5.Hash.process(data.view(), value);
+						Kernel.Tool.Data.Hash.MD5.Hash.process_file(Kernel.Path.value(data_file), value);
 						return integer_from_byte_array([...new Uint8Array(value.value)].map(BigInt), null, 'little');
 					}
 
@@ -583,9 +623,8 @@ namespace TwinStar.Script.KernelX {
 						mode: typeof Kernel.Tool.Data.Hash.FNV.Mode.Value,
 						bit_count: typeof Kernel.Tool.Data.Hash.FNV.BitCount.Value,
 					): bigint {
-						let data = FileSystem.read_file(data_file);
 						let value = Kernel.ByteArray.default();
-						Kernel.Tool.Data.Hash.FNV.Hash.process(data.view(), value, Kernel.Tool.Data.Hash.FNV.Mode.value(mode), Kernel.Tool.Data.Hash.FNV.BitCount.value(bit_count));
+						Kernel.Tool.Data.Hash.FNV.Hash.process_file(Kernel.Path.value(data_file), value, Kernel.Tool.Data.Hash.FNV.Mode.value(mode), Kernel.Tool.Data.Hash.FNV.BitCount.value(bit_count));
 						return integer_from_byte_array([...new Uint8Array(value.value)].map(BigInt), null, 'current');
 					}
 
@@ -928,11 +967,14 @@ namespace TwinStar.Script.KernelX {
 					return Kernel.Tool.Texture.Transformation.Flip.process(target, Kernel.Boolean.value(horizontal), Kernel.Boolean.value(vertical));
 				}
 
+				export type ScaleMethod = typeof Kernel.Tool.Texture.Transformation.ScaleMethod.Value;
+
 				export function scale(
 					source: Kernel.Image.CImageView,
 					destination: Kernel.Image.VImageView,
+					method: ScaleMethod = 'avir',
 				): void {
-					return Kernel.Tool.Texture.Transformation.Scale.process(source, destination);
+					return Kernel.Tool.Texture.Transformation.Scale.process(source, destination, Kernel.Tool.Texture.Transformation.ScaleMethod.value(method));
 				}
 
 				// ------------------------------------------------
@@ -954,12 +996,13 @@ namespace TwinStar.Script.KernelX {
 					source_file: string,
 					destination_file: string,
 					size: Image.ImageSize,
+					method: ScaleMethod = 'avir',
 				): void {
 					let source = KernelX.Image.File.PNG.read_fs_of(source_file);
 					let source_view = source.view();
 					let destination = Kernel.Image.Image.allocate(Kernel.Image.ImageSize.value(size));
 					let destination_view = destination.view();
-					scale(source_view, destination_view);
+					scale(source_view, destination_view, method);
 					KernelX.Image.File.PNG.write_fs(destination_file, destination_view);
 					return;
 				}
@@ -968,12 +1011,13 @@ namespace TwinStar.Script.KernelX {
 					source_file: string,
 					destination_file: string,
 					size_rate: number,
+					method: ScaleMethod = 'avir',
 				): void {
 					let source = KernelX.Image.File.PNG.read_fs_of(source_file);
 					let source_view = source.view();
 					let destination = Kernel.Image.Image.allocate(Kernel.Image.ImageSize.value([BigInt(Math.max(1, Math.round(Number(source.size().value[0]) * size_rate))), BigInt(Math.max(1, Math.round(Number(source.size().value[1]) * size_rate)))]));
 					let destination_view = destination.view();
-					scale(source_view, destination_view);
+					scale(source_view, destination_view, method);
 					KernelX.Image.File.PNG.write_fs(destination_file, destination_view);
 					return;
 				}
@@ -1404,6 +1448,17 @@ namespace TwinStar.Script.KernelX {
 					return;
 				}
 
+				export function unpack_partial_fs(
+					data_file: string,
+					resource: Array<string>,
+					resource_directory: string,
+					version: typeof Kernel.Tool.Marmalade.DZip.Version.Value,
+				): void {
+					let version_c = Kernel.Tool.Marmalade.DZip.Version.value(version);
+					Kernel.Tool.Marmalade.DZip.Unpack.process_file_partial(Kernel.Path.value(data_file), Kernel.PathList.value(resource), Kernel.Path.value(resource_directory), version_c);
+					return;
+				}
+
 			}
 
 		}
@@ -2022,12 +2077,15 @@ namespace TwinStar.Script.KernelX {
 					definition_file: null | string,
 					resource_directory: null | string,
 					version: typeof Kernel.Tool.PopCap.Package.Version.Value,
+					key: Array<bigint> = [],
 				): void {
 					let version_c = Kernel.Tool.PopCap.Package.Version.value(version);
 					let data = FileSystem.read_file(data_file);
 					let data_stream = Kernel.ByteStreamView.watch(data.view());
 					let definition = Kernel.Tool.PopCap.Package.Definition.Package.default();
-					Kernel.Tool.PopCap.Package.Unpack.process(data_stream, definition, Kernel.PathOptional.value(resource_directory), version_c);
+					let key_c = Kernel.ByteArray.allocate(Kernel.Size.value(BigInt(key.length)));
+					new Uint8Array(key_c.view().value).set(key.map(Number));
+					Kernel.Tool.PopCap.Package.Unpack.process(data_stream, definition, Kernel.PathOptional.value(resource_directory), key_c.view(), version_c);
 					if (definition_file !== null) {
 						JSON.write_fs(definition_file, definition.get_json(version_c));
 					}
@@ -2095,11 +2153,15 @@ namespace TwinStar.Script.KernelX {
 					packet_file: null | string,
 					new_packet_file: null | string,
 					version: typeof Kernel.Tool.PopCap.ResourceStreamBundle.Version.Value,
-					data_buffer: Kernel.ByteListView | bigint,
+					data_buffer: null | Kernel.ByteListView | bigint,
 				): void {
 					let version_c = Kernel.Tool.PopCap.ResourceStreamBundle.Version.value(version);
 					let definition = Kernel.Tool.PopCap.ResourceStreamBundle.Definition.Package.json(JSON.read_fs(definition_file), version_c);
 					let manifest = Kernel.Tool.PopCap.ResourceStreamBundle.Manifest.PackageOptional.json(JSON.read_fs(manifest_file), version_c);
+					if (data_buffer === null) {
+						Kernel.Tool.PopCap.ResourceStreamBundle.Pack.process_file(Kernel.Path.value(data_file), definition, manifest, Kernel.Path.value(resource_directory), Kernel.PathOptional.value(packet_file), Kernel.PathOptional.value(new_packet_file), version_c);
+						return;
+					}
 					let data = is_bigint(data_buffer) ? Kernel.ByteArray.allocate(Kernel.Size.value(data_buffer)) : null;
 					let data_stream = Kernel.ByteStreamView.watch(data_buffer instanceof Kernel.ByteListView ? data_buffer : data!.view());
 					Kernel.Tool.PopCap.ResourceStreamBundle.Pack.process(data_stream, definition, manifest, Kernel.Path.value(resource_directory), Kernel.PathOptional.value(packet_file), Kernel.PathOptional.value(new_packet_file), version_c);
@@ -2130,6 +2192,16 @@ namespace TwinStar.Script.KernelX {
 					return;
 				}
 
+				export function index_fs(
+					data_file: string,
+					version: typeof Kernel.Tool.PopCap.ResourceStreamBundle.Version.Value,
+				): Kernel.Tool.PopCap.ResourceStreamBundle.Index.JS_N.Package {
+					let version_c = Kernel.Tool.PopCap.ResourceStreamBundle.Version.value(version);
+					let index = Kernel.Tool.PopCap.ResourceStreamBundle.Index.Package.default();
+					Kernel.Tool.PopCap.ResourceStreamBundle.Unpack.process_index_file(Kernel.Path.value(data_file), index, version_c);
+					return index.get_json(version_c).value;
+				}
+
 			}
 
 			export namespace ResourceStreamBundlePatch {
@@ -2347,6 +2419,35 @@ namespace TwinStar.Script.KernelX {
 
 			}
 
+			export namespace PvZ2ResourceManifest {
+
+				export function encode_fs(
+					data_file: string,
+					definition_file: string,
+					data_buffer: Kernel.ByteListView | bigint,
+				): void {
+					let definition = JSON.read_fs<Kernel.Tool.Miscellaneous.PvZ2ResourceManifest.JS_Definition>(definition_file);
+					let data = is_bigint(data_buffer) ? Kernel.ByteArray.allocate(Kernel.Size.value(data_buffer)) : null;
+					let data_stream = Kernel.ByteStreamView.watch(data_buffer instanceof Kernel.ByteListView ? data_buffer : data!.view());
+					Kernel.Tool.Miscellaneous.PvZ2ResourceManifest.Encode.process(data_stream, definition);
+					FileSystem.write_file(data_file, data_stream.stream_view());
+					return;
+				}
+
+				export function decode_fs(
+					data_file: string,
+					definition_file: string,
+				): void {
+					let data = FileSystem.read_file(data_file);
+					let data_stream = Kernel.ByteStreamView.watch(data.view());
+					let definition = Kernel.JSON.Value.default<Kernel.Tool.Miscellaneous.PvZ2ResourceManifest.JS_Definition>();
+					Kernel.Tool.Miscellaneous.PvZ2ResourceManifest.Decode.process(data_stream, definition);
+					JSON.write_fs(definition_file, definition);
+					return;
+				}
+
+			}
+
 		}
 
 	}